@@ -5,6 +5,7 @@
 #include "PEHookAbility.h"
 #include "PEHookAbility_Task.h"
 #include <GAS/Targeting/PELineTargeting.h>
+#include <GAS/System/PEGASProfiler.h>
 #include <GAS/System/PETrace.h>
 #include <Management/Data/PEGlobalTags.h>
 #include <GameFramework/Character.h>
@@ -12,14 +13,14 @@
 
 UPEHookAbility::UPEHookAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), HookIntensity(100.f), ImpulseIntensityMultiplier(30.f), MaxHookForce(200000.f)
 {
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Swinging"));
+	AbilityTags.AddTag(GlobalTag_Ability_Swinging);
 
-	ActivationOwnedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_RegenBlock_Stamina));
-	ActivationOwnedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_RegenBlock_Mana));
-	ActivationOwnedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_AimingBlockedState));
+	ActivationOwnedTags.AddTag(GlobalTag_RegenBlock_Stamina);
+	ActivationOwnedTags.AddTag(GlobalTag_RegenBlock_Mana);
+	ActivationOwnedTags.AddTag(GlobalTag_AimingBlockedState);
 
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_WeaponSlot_Base));
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_AimingState));
+	ActivationBlockedTags.AddTag(GlobalTag_WeaponSlot_Base);
+	ActivationBlockedTags.AddTag(GlobalTag_AimingState);
 
 	bWaitCancel = false;
 	bIgnoreCooldown = true;
@@ -27,12 +28,14 @@ UPEHookAbility::UPEHookAbility(const FObjectInitializer& ObjectInitializer) : Su
 
 void UPEHookAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	bIgnoreCooldown = true;
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
 	// Activate tasks: Animation Montage and Wait for GameplayEvent (Anim Notify)
 	ActivateWaitMontageTask(NAME_None, 1.5f);
-	ActivateWaitGameplayEventTask(FGameplayTag::RequestGameplayTag(GlobalTag_AbilityNotify));
+	ActivateWaitGameplayEventTask(GlobalTag_AbilityNotify);
 }
 
 void UPEHookAbility::InputReleased(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo)
@@ -82,21 +85,12 @@ void UPEHookAbility::WaitTargetData_Callback_Implementation(const FGameplayAbili
 
 	TargetData->AddTargetDataToGameplayCueParameters(Params);
 
-	ActivateGameplayCues(FGameplayTag::RequestGameplayTag("GameplayCue.Swinging"), Params);
+	ActivateGameplayCues(GlobalTag_Cue_Swinging, Params);
 
 	// If the target is a character, will finish this ability after AbilityActiveTime seconds
 	if (TargetHit->GetActor()->GetClass()->IsChildOf<ACharacter>() && TargetHit->GetActor() != GetAvatarActorFromActorInfo() || TargetHit->GetComponent()->GetClass()->IsChildOf<UGeometryCollectionComponent>())
 	{
-		FTimerDelegate TimerDelegate;
-		TimerDelegate.BindLambda([=]() -> void
-		{
-			if (IsValid(this) && IsActive())
-			{
-				EndAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo(), true, false);
-			}
-		});
-
-		GetWorld()->GetTimerManager().SetTimer(CancelationTimerHandle, TimerDelegate, AbilityActiveTime, false);
+		ScheduleEndAbility(AbilityActiveTime);
 	}
 
 	// Start waiting for confirm input
@@ -107,7 +101,7 @@ void UPEHookAbility::WaitConfirmInput_Callback_Implementation()
 {
 	// If the confirm input is pressed, will add a impulse to ability owner
 	// and to the target/grabbed actor, if simulates physics
-	if (ACharacter* const Player = Cast<ACharacter>(GetAvatarActorFromActorInfo()))
+	if (ACharacter* const Player = Cast<ACharacter>(GetAvatarActorFromActorInfo()); IsValid(Player) && TaskHandle.IsValid())
 	{
 		PlayAbilitySoundAttached(Player->GetMesh());
 
@@ -115,9 +109,10 @@ void UPEHookAbility::WaitConfirmInput_Callback_Implementation()
 
 		Player->LaunchCharacter(ImpulseVector, false, true);
 
-		if (TaskHandle->GetHitResult().GetComponent()->IsSimulatingPhysics())
+		// The hooked component may have been destroyed while the hook was active
+		if (UPrimitiveComponent* const HitComponent = TaskHandle->GetHitResult().GetComponent(); IsValid(HitComponent) && HitComponent->IsSimulatingPhysics())
 		{
-			TaskHandle->GetHitResult().GetComponent()->AddImpulse(-1.f * ImpulseVector);
+			HitComponent->AddImpulse(-1.f * ImpulseVector);
 		}
 		else if (ACharacter* const TargetPlayer = Cast<ACharacter>(TaskHandle->GetHitResult().GetActor()))
 		{
@@ -131,3 +126,14 @@ void UPEHookAbility::WaitConfirmInput_Callback_Implementation()
 
 	EndAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo(), true, false);
 }
+
+void UPEHookAbility::OnGameplayTaskDeactivated(UGameplayTask& Task)
+{
+	Super::OnGameplayTaskDeactivated(Task);
+
+	// Ended tasks are destroyed: Don't keep a handle to them
+	if (&Task == TaskHandle.Get())
+	{
+		TaskHandle.Reset();
+	}
+}
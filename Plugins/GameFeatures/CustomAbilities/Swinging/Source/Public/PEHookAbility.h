@@ -43,6 +43,8 @@ protected:
 
 	virtual void WaitConfirmInput_Callback_Implementation() override;
 
+	virtual void OnGameplayTaskDeactivated(UGameplayTask& Task) override;
+
 private:
 	TWeakObjectPtr<UPEHookAbility_Task> TaskHandle;
 };
@@ -6,21 +6,24 @@
 #include "PETelekinesisAbility_Task.h"
 #include "PEThrowableActor.h"
 #include <GAS/Targeting/PELineTargeting.h>
+#include <GAS/System/PEGASProfiler.h>
 #include <GAS/System/PETrace.h>
 #include <Management/Data/PEGlobalTags.h>
 
 UPETelekinesisAbility::UPETelekinesisAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), ThrowIntensity(2750.f)
 {
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Telekinesis"));
+	AbilityTags.AddTag(GlobalTag_Ability_Telekinesis);
 
-	ActivationOwnedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_RegenBlock_Mana));
-	ActivationOwnedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_CannotInteract));
+	ActivationOwnedTags.AddTag(GlobalTag_RegenBlock_Mana);
+	ActivationOwnedTags.AddTag(GlobalTag_CannotInteract);
 
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_WeaponSlot_Base));
+	ActivationBlockedTags.AddTag(GlobalTag_WeaponSlot_Base);
 }
 
 void UPETelekinesisAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
 	// Targeting: Params	
@@ -81,7 +84,7 @@ void UPETelekinesisAbility::WaitTargetData_Callback_Implementation(const FGamepl
 
 	TargetData->AddTargetDataToGameplayCueParameters(Params);
 
-	ActivateGameplayCues(FGameplayTag::RequestGameplayTag("GameplayCue.Telekinesis"), Params);
+	ActivateGameplayCues(GlobalTag_Cue_Telekinesis, Params);
 }
 
 void UPETelekinesisAbility::GrabbingComplete(const bool ValidTarget)
@@ -92,7 +95,7 @@ void UPETelekinesisAbility::GrabbingComplete(const bool ValidTarget)
 	if (ValidTarget)
 	{
 		ActivateWaitConfirmInputTask();
-		ActivateWaitGameplayEventTask(FGameplayTag::RequestGameplayTag(GlobalTag_AbilityNotify));
+		ActivateWaitGameplayEventTask(GlobalTag_AbilityNotify);
 	}
 	else
 	{
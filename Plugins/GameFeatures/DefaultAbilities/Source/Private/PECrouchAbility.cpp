@@ -4,16 +4,20 @@
 
 #include "PECrouchAbility.h"
 #include <GameFramework/Character.h>
+#include <GAS/System/PEGASProfiler.h>
+#include <Management/Data/PEGlobalTags.h>
 
 UPECrouchAbility::UPECrouchAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::NonInstanced;
 
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.Crouch"));
+	AbilityTags.AddTag(GlobalTag_Ability_Crouch);
 }
 
 void UPECrouchAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
 	ACharacter* const Player = Cast<ACharacter>(ActorInfo->AvatarActor.Get());
@@ -3,6 +3,7 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "PEDoubleJumpAbility.h"
+#include <GAS/System/PEGASProfiler.h>
 #include <Management/Data/PEGlobalTags.h>
 #include <GameFramework/Character.h>
 #include <GameFramework/CharacterMovementComponent.h>
@@ -11,14 +12,16 @@ UPEDoubleJumpAbility::UPEDoubleJumpAbility(const FObjectInitializer& ObjectIniti
 {
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::NonInstanced;
 
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.DoubleJump"));
+	AbilityTags.AddTag(GlobalTag_Ability_DoubleJump);
 
-	ActivationOwnedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_RegenBlock_Stamina));
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.Dash"));
+	ActivationOwnedTags.AddTag(GlobalTag_RegenBlock_Stamina);
+	ActivationBlockedTags.AddTag(GlobalTag_Ability_Dash);
 }
 
 void UPEDoubleJumpAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
 	ACharacter* const Player = Cast<ACharacter>(ActorInfo->AvatarActor.Get());
@@ -42,7 +45,7 @@ void UPEDoubleJumpAbility::ActivateAbility(const FGameplayAbilitySpecHandle Hand
 
 		FGameplayCueParameters Params;
 		Params.Location = VFXLocation;
-		ActivateGameplayCues(FGameplayTag::RequestGameplayTag("GameplayCue.Default.DoubleJump"), Params, ActorInfo->AbilitySystemComponent.Get());
+		ActivateGameplayCues(GlobalTag_Cue_DoubleJump, Params, ActorInfo->AbilitySystemComponent.Get());
 
 		PlayAbilitySoundAtLocation(ActorInfo->AvatarActor.Get(), VFXLocation);
 
@@ -6,24 +6,33 @@
 #include "Tasks/PEInteractAbility_Task.h"
 #include <Actors/Character/PECharacter.h>
 #include <Actors/Interfaces/PEInteractable.h>
+#include <GAS/System/PEGASProfiler.h>
+#include <Management/Data/PEGlobalTags.h>
 
 UPEInteractAbility::UPEInteractAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.Interact"));
+	AbilityTags.AddTag(GlobalTag_Ability_Interact);
 	bAutoActivateOnGrant = true;
 	bWaitCancel = false;
 
 	AbilityMaxRange = 1000.f;
 	bUseCustomDepth = false;
 
+	ScanInterval = 0.1f;
+	ScanMinimumMovement = 1.f;
+	ScanMinimumRotation = 0.5f;
+	FocusConeAngle = 5.f;
+
 	bReplicateInputDirectly = true;
 }
 
 void UPEInteractAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
-	TaskHandle = UPEInteractAbility_Task::InteractionTask(this, TEXT("InteractTask"), AbilityMaxRange, bUseCustomDepth);
+	TaskHandle = UPEInteractAbility_Task::InteractionTask(this, TEXT("InteractTask"), AbilityMaxRange, bUseCustomDepth, ScanInterval, ScanMinimumMovement, ScanMinimumRotation, FocusConeAngle);
 	TaskHandle->ReadyForActivation();
 }
 
@@ -31,7 +40,15 @@ void UPEInteractAbility::InputPressed(const FGameplayAbilitySpecHandle Handle, c
 {
 	Super::InputPressed(Handle, ActorInfo, ActivationInfo);
 
-	if (TaskHandle.IsValid() && TaskHandle->GetIsInteractAllowed())
+	if (!TaskHandle.IsValid() || !TaskHandle->IsActive())
+	{
+		return;
+	}
+
+	// Scans are throttled (and disabled on the server for remote players): Resolve the interactable with the current view
+	TaskHandle->UpdateInteractable();
+
+	if (TaskHandle->GetIsInteractAllowed())
 	{
 		if (IsValid(TaskHandle->GetInteractable()) && IPEInteractable::Execute_IsInteractEnabled(TaskHandle->GetInteractable()))
 		{
@@ -39,3 +56,14 @@ void UPEInteractAbility::InputPressed(const FGameplayAbilitySpecHandle Handle, c
 		}
 	}
 }
+
+void UPEInteractAbility::OnGameplayTaskDeactivated(UGameplayTask& Task)
+{
+	Super::OnGameplayTaskDeactivated(Task);
+
+	// Ended tasks are destroyed: Don't keep a handle to them
+	if (&Task == TaskHandle.Get())
+	{
+		TaskHandle.Reset();
+	}
+}
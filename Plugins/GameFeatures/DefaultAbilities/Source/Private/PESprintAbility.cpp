@@ -3,20 +3,23 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "PESprintAbility.h"
+#include <GAS/System/PEGASProfiler.h>
 #include <Management/Data/PEGlobalTags.h>
 
 UPESprintAbility::UPESprintAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::NonInstanced;
 
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.Sprint"));
+	AbilityTags.AddTag(GlobalTag_Ability_Sprint);
 
-	ActivationOwnedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_CanInteract));
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.Walk"));
+	ActivationOwnedTags.AddTag(GlobalTag_CanInteract);
+	ActivationBlockedTags.AddTag(GlobalTag_Ability_Walk);
 }
 
 void UPESprintAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
 	//We don't need this ability if the character is not walking
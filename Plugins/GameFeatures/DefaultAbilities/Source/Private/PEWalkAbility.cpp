@@ -3,17 +3,21 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "PEWalkAbility.h"
+#include <GAS/System/PEGASProfiler.h>
+#include <Management/Data/PEGlobalTags.h>
 
 UPEWalkAbility::UPEWalkAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::NonInstanced;
 
-	AbilityTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.Walk"));
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag("GameplayAbility.Default.Sprint"));
+	AbilityTags.AddTag(GlobalTag_Ability_Walk);
+	ActivationBlockedTags.AddTag(GlobalTag_Ability_Sprint);
 }
 
 void UPEWalkAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
 
 	//We don't need this ability if the character is not walking
@@ -7,21 +7,44 @@
 #include <Actors/Interfaces/PEInteractable.h>
 #include <GAS/Targeting/PELineTargeting.h>
 #include <Management/Data/PEGlobalTags.h>
+#include <Management/Subsystems/PEInteractableSubsystem.h>
+#include <Management/ProjectElementus.h>
 #include <Abilities/GameplayAbilityTargetDataFilter.h>
 #include <Abilities/Tasks/AbilityTask_WaitGameplayTag.h>
 #include <AbilitySystemComponent.h>
 
+DECLARE_CYCLE_STAT(TEXT("Interaction Task Tick"), STAT_PEInteractionTick, STATGROUP_ProjectElementus);
+DECLARE_CYCLE_STAT(TEXT("Interaction Scan"), STAT_PEInteractionScan, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interaction Scans"), STAT_PEInteractionScans, STATGROUP_ProjectElementus);
+
 UPEInteractAbility_Task::UPEInteractAbility_Task(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	bTickingTask = true;
 	bIsFinished = false;
+
+	ScanInterval = 0.f;
+	ScanMinimumMovementSquared = 0.f;
+	ScanMinimumRotationCos = 1.f;
+	ScanElapsedTime = 0.f;
+	FocusConeAngle = 0.f;
+
+	LastScanLocation = FVector::ZeroVector;
+	LastScanDirection = FVector::ZeroVector;
+	bHasScanned = false;
+
+	bIsLocallyControlled = false;
+	bAddedCanInteractTag = false;
 }
 
-UPEInteractAbility_Task* UPEInteractAbility_Task::InteractionTask(UGameplayAbility* OwningAbility, const FName& TaskInstanceName, const float InteractionRange, const bool bUseCustomDepth)
+UPEInteractAbility_Task* UPEInteractAbility_Task::InteractionTask(UGameplayAbility* OwningAbility, const FName& TaskInstanceName, const float InteractionRange, const bool bUseCustomDepth, const float ScanInterval, const float ScanMinimumMovement, const float ScanMinimumRotation, const float FocusConeAngle)
 {
-	UPEInteractAbility_Task* const MyObj = NewAbilityTask < UPEInteractAbility_Task > (OwningAbility, TaskInstanceName);
+	UPEInteractAbility_Task* const MyObj = NewAbilityTask<UPEInteractAbility_Task>(OwningAbility, TaskInstanceName);
 	MyObj->Range = InteractionRange;
 	MyObj->bUseCustomDepth = bUseCustomDepth;
+	MyObj->ScanInterval = FMath::Max(ScanInterval, 0.f);
+	MyObj->ScanMinimumMovementSquared = FMath::Square(ScanMinimumMovement);
+	MyObj->ScanMinimumRotationCos = FMath::Cos(FMath::DegreesToRadians(ScanMinimumRotation));
+	MyObj->FocusConeAngle = FocusConeAngle;
 
 	return MyObj;
 }
@@ -36,15 +59,22 @@ void UPEInteractAbility_Task::Activate()
 
 	if (ensureAlwaysMsgf(InteractionOwner.IsValid(), TEXT("%s - Task %s failed to activate because have a invalid owner"), *FString(__func__), *GetName()))
 	{
-		UAbilityTask_WaitGameplayTagAdded* const WaitGameplayTagAdd = UAbilityTask_WaitGameplayTagAdded::WaitGameplayTagAdd(Ability, FGameplayTag::RequestGameplayTag(TEXT("State.CannotInteract")));
+		// The server only scans remote players on demand (when the interaction input is received)
+		bIsLocallyControlled = InteractionOwner->IsLocallyControlled();
+		bTickingTask = bIsLocallyControlled;
+
+		UAbilityTask_WaitGameplayTagAdded* const WaitGameplayTagAdd = UAbilityTask_WaitGameplayTagAdded::WaitGameplayTagAdd(Ability, GlobalTag_CannotInteract);
 		WaitGameplayTagAdd->Added.AddDynamic(this, &UPEInteractAbility_Task::OnCannotInteractChanged);
 
-		UAbilityTask_WaitGameplayTagRemoved* const WaitGameplayTagRemove = UAbilityTask_WaitGameplayTagRemoved::WaitGameplayTagRemove(Ability, FGameplayTag::RequestGameplayTag(TEXT("State.CannotInteract")));
+		UAbilityTask_WaitGameplayTagRemoved* const WaitGameplayTagRemove = UAbilityTask_WaitGameplayTagRemoved::WaitGameplayTagRemove(Ability, GlobalTag_CannotInteract);
 		WaitGameplayTagRemove->Removed.AddDynamic(this, &UPEInteractAbility_Task::OnCannotInteractChanged);
 
 		WaitGameplayTagAdd->ReadyForActivation();
 		WaitGameplayTagRemove->ReadyForActivation();
 
+		WaitCannotInteractAdd_Ref = WaitGameplayTagAdd;
+		WaitCannotInteractRemove_Ref = WaitGameplayTagRemove;
+
 		return;
 	}
 
@@ -54,7 +84,7 @@ void UPEInteractAbility_Task::Activate()
 
 bool UPEInteractAbility_Task::GetIsInteractAllowed() const
 {
-	return AbilitySystemComponent->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_CanInteract)) && !AbilitySystemComponent->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_CannotInteract));
+	return AbilitySystemComponent->HasMatchingGameplayTag(GlobalTag_CanInteract) && !AbilitySystemComponent->HasMatchingGameplayTag(GlobalTag_CannotInteract);
 }
 
 AActor* UPEInteractAbility_Task::GetInteractable() const
@@ -67,13 +97,29 @@ FHitResult UPEInteractAbility_Task::GetInteractableHitResult() const
 	return HitResult;
 }
 
+void UPEInteractAbility_Task::UpdateInteractable()
+{
+	if (bIsFinished || !InteractionOwner.IsValid())
+	{
+		return;
+	}
+
+	ScanInteractable(InteractionOwner->GetCameraComponentLocation(), InteractionOwner->GetCameraForwardVector());
+}
+
 void UPEInteractAbility_Task::OnCannotInteractChanged()
 {
-	bTickingTask = !AbilitySystemComponent->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_CannotInteract));
+	// The focus highlight is cosmetic: Remote players are only scanned on demand by the server
+	bTickingTask = bIsLocallyControlled && !AbilitySystemComponent->HasMatchingGameplayTag(GlobalTag_CannotInteract);
+
+	// Scan as soon as the ticking resumes
+	bHasScanned = false;
 }
 
 void UPEInteractAbility_Task::TickTask(const float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_PEInteractionTick);
+
 	if (bIsFinished)
 	{
 		EndTask();
@@ -82,57 +128,130 @@ void UPEInteractAbility_Task::TickTask(const float DeltaTime)
 
 	Super::TickTask(DeltaTime);
 
-	HitResult.Reset(0.f, false);
+	ScanElapsedTime += DeltaTime;
+	if (bHasScanned && ScanElapsedTime < ScanInterval)
+	{
+		return;
+	}
 
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(Ability->GetAvatarActorFromActorInfo());
+	const FVector CameraLocation = InteractionOwner->GetCameraComponentLocation();
+	const FVector CameraDirection = InteractionOwner->GetCameraForwardVector();
 
-	const FVector StartLocation = InteractionOwner->GetCameraComponentLocation();
-	const FVector EndLocation = StartLocation + InteractionOwner->GetCameraForwardVector() * Range;
+	// A destroyed interactable must be cleared even if the camera didn't move
+	if (const bool bLostInteractable = !LastInteractableActor_Ref.IsValid() && bAddedCanInteractTag;
+		bHasScanned && !bLostInteractable && !HasCameraMovedSinceLastScan(CameraLocation, CameraDirection))
+	{
+		return;
+	}
+
+	ScanInteractable(CameraLocation, CameraDirection);
+}
+
+bool UPEInteractAbility_Task::HasCameraMovedSinceLastScan(const FVector& InLocation, const FVector& InDirection) const
+{
+	return FVector::DistSquared(InLocation, LastScanLocation) > ScanMinimumMovementSquared || FVector::DotProduct(InDirection, LastScanDirection) < ScanMinimumRotationCos;
+}
+
+void UPEInteractAbility_Task::ScanInteractable(const FVector& InLocation, const FVector& InDirection)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PEInteractionScan);
+	INC_DWORD_STAT(STAT_PEInteractionScans);
+
+	ScanElapsedTime = 0.f;
+	LastScanLocation = InLocation;
+	LastScanDirection = InDirection;
+	bHasScanned = true;
+
+	HitResult.Reset(0.f, false);
 
-	const FGameplayTargetDataFilterHandle DataFilterHandle;
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(PEInteractionScan), false);
+	QueryParams.AddIgnoredActor(InteractionOwner.Get());
 
-	APELineTargeting::LineTraceWithFilter(HitResult, GetWorld(), DataFilterHandle, StartLocation, EndLocation, TEXT("Target"), QueryParams);
+	AActor* HitActor = nullptr;
 
-	if (!HitResult.bBlockingHit || !IsValid(HitResult.GetActor()) || !HitResult.GetActor()->Implements<UPEInteractable>())
+	// Registered interactables are found with a view cone query and an occlusion trace
+	if (const UPEInteractableSubsystem* const InteractableSubsystem = FocusConeAngle > 0.f ? UPEInteractableSubsystem::Get(GetWorld()) : nullptr)
 	{
-		if (AbilitySystemComponent->HasMatchingGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_CanInteract)))
-		{
-			AbilitySystemComponent->RemoveLooseGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_CanInteract));
-		}
+		HitActor = InteractableSubsystem->FindFocusCandidate(InLocation, InDirection, Range, FocusConeAngle, QueryParams, HitResult);
+	}
 
-		if (LastInteractableActor_Ref.IsValid())
-		{
-			IPEInteractable::Execute_SetIsCurrentlyFocusedByActor(LastInteractableActor_Ref.Get(), false, InteractionOwner.Get(), HitResult);
-			LastInteractableActor_Ref.Reset();
-
-			if (LastInteractablePrimitive_Ref.IsValid())
-			{
-				if (bUseCustomDepth)
-				{
-					LastInteractablePrimitive_Ref->SetRenderCustomDepth(false);
-				}
-
-				LastInteractablePrimitive_Ref.Reset();
-			}
-		}
-		
+	// Interactables that aren't registered (e.g. Blueprint interactables) can still be focused with the line trace
+	if (!IsValid(HitActor))
+	{
+		const FVector EndLocation = InLocation + InDirection * Range;
+
+		const FGameplayTargetDataFilterHandle DataFilterHandle;
+
+		APELineTargeting::LineTraceWithFilter(HitResult, GetWorld(), DataFilterHandle, InLocation, EndLocation, TEXT("Target"), QueryParams);
+
+		HitActor = HitResult.bBlockingHit ? HitResult.GetActor() : nullptr;
+	}
+
+	// Still focusing the same interactable: No need to check the interface again
+	if (IsValid(HitActor) && HitActor == LastInteractableActor_Ref.Get())
+	{
 		return;
 	}
 
-	if (LastInteractableActor_Ref.Get() != HitResult.GetActor())
+	if (!IsValid(HitActor) || !HitActor->Implements<UPEInteractable>())
 	{
-		LastInteractableActor_Ref = HitResult.GetActor();
-		LastInteractablePrimitive_Ref = HitResult.GetComponent();
+		ClearInteractable();
+		SetCanInteractTag(false);
+
+		return;
+	}
+
+	ClearInteractable();
 
-		IPEInteractable::Execute_SetIsCurrentlyFocusedByActor(LastInteractableActor_Ref.Get(), true, InteractionOwner.Get(), HitResult);
+	LastInteractableActor_Ref = HitActor;
+	LastInteractablePrimitive_Ref = HitResult.GetComponent();
 
-		if (bUseCustomDepth)
+	if (bIsLocallyControlled)
+	{
+		IPEInteractable::Execute_SetIsCurrentlyFocusedByActor(HitActor, true, InteractionOwner.Get(), HitResult);
+
+		if (bUseCustomDepth && LastInteractablePrimitive_Ref.IsValid())
 		{
 			LastInteractablePrimitive_Ref->SetRenderCustomDepth(true);
 		}
+	}
+
+	SetCanInteractTag(true);
+}
+
+void UPEInteractAbility_Task::ClearInteractable()
+{
+	if (LastInteractableActor_Ref.IsValid() && bIsLocallyControlled)
+	{
+		IPEInteractable::Execute_SetIsCurrentlyFocusedByActor(LastInteractableActor_Ref.Get(), false, InteractionOwner.Get(), HitResult);
+	}
+
+	if (LastInteractablePrimitive_Ref.IsValid() && bUseCustomDepth && bIsLocallyControlled)
+	{
+		LastInteractablePrimitive_Ref->SetRenderCustomDepth(false);
+	}
 
-		AbilitySystemComponent->AddLooseGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_CanInteract));
+	LastInteractableActor_Ref.Reset();
+	LastInteractablePrimitive_Ref.Reset();
+}
+
+void UPEInteractAbility_Task::SetCanInteractTag(const bool bInCanInteract)
+{
+	// Only the tag added by this task is tracked: Avoid a tag lookup on each scan
+	if (bAddedCanInteractTag == bInCanInteract)
+	{
+		return;
+	}
+
+	bAddedCanInteractTag = bInCanInteract;
+
+	if (bInCanInteract)
+	{
+		AbilitySystemComponent->AddLooseGameplayTag(GlobalTag_CanInteract);
+	}
+	else
+	{
+		AbilitySystemComponent->RemoveLooseGameplayTag(GlobalTag_CanInteract);
 	}
 }
 
@@ -142,16 +261,22 @@ void UPEInteractAbility_Task::OnDestroy(const bool AbilityIsEnding)
 
 	bIsFinished = true;
 
-	if (LastInteractableActor_Ref.IsValid())
+	ClearInteractable();
+
+	if (AbilitySystemComponent.IsValid())
 	{
-		IPEInteractable::Execute_SetIsCurrentlyFocusedByActor(LastInteractableActor_Ref.Get(), false, InteractionOwner.Get(), HitResult);
-		LastInteractableActor_Ref.Reset();
+		SetCanInteractTag(false);
+	}
 
-		if (LastInteractablePrimitive_Ref.IsValid())
-		{
-			LastInteractablePrimitive_Ref->SetRenderCustomDepth(false);
-			LastInteractablePrimitive_Ref.Reset();
-		}
+	// The wait tasks are owned by the ability and may outlive this task
+	if (WaitCannotInteractAdd_Ref.IsValid())
+	{
+		WaitCannotInteractAdd_Ref->Added.RemoveAll(this);
+	}
+
+	if (WaitCannotInteractRemove_Ref.IsValid())
+	{
+		WaitCannotInteractRemove_Ref->Removed.RemoveAll(this);
 	}
 
 	Super::OnDestroy(AbilityIsEnding);
@@ -25,11 +25,29 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Project Elementus | Properties")
 	bool bUseCustomDepth;
 
+	/* Minimum time between interaction scans. 0 scans every frame */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Project Elementus | Properties", meta = (ClampMin = "0"))
+	float ScanInterval;
+
+	/* Scans are skipped while the camera has moved less than this distance since the last scan */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Project Elementus | Properties", meta = (ClampMin = "0"))
+	float ScanMinimumMovement;
+
+	/* Scans are skipped while the camera has rotated less than this angle (in degrees) since the last scan */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Project Elementus | Properties", meta = (ClampMin = "0", ClampMax = "180"))
+	float ScanMinimumRotation;
+
+	/* Half angle (in degrees) of the view cone used to query the registered interactables. 0 uses a line trace against the Target profile instead */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Project Elementus | Properties", meta = (ClampMin = "0", ClampMax = "89"))
+	float FocusConeAngle;
+
 protected:
 	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
 
 	virtual void InputPressed(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) override;
 
+	virtual void OnGameplayTaskDeactivated(UGameplayTask& Task) override;
+
 private:
 	TWeakObjectPtr<UPEInteractAbility_Task> TaskHandle;
 };
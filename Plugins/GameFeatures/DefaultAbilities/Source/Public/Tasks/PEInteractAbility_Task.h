@@ -20,7 +20,7 @@ public:
 	explicit UPEInteractAbility_Task(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	/* Create a reference to manage this ability task */
-	static UPEInteractAbility_Task* InteractionTask(UGameplayAbility* OwningAbility, const FName& TaskInstanceName, const float InteractionRange, const bool bUseCustomDepth = false);
+	static UPEInteractAbility_Task* InteractionTask(UGameplayAbility* OwningAbility, const FName& TaskInstanceName, const float InteractionRange, const bool bUseCustomDepth = false, const float ScanInterval = 0.f, const float ScanMinimumMovement = 0.f, const float ScanMinimumRotation = 0.f, const float FocusConeAngle = 0.f);
 
 	virtual void Activate() override;
 
@@ -30,6 +30,9 @@ public:
 
 	FHitResult GetInteractableHitResult() const;
 
+	/* Scan for interactables now, ignoring the scan interval and the camera motion threshold */
+	void UpdateInteractable();
+
 private:
 	virtual void TickTask(float DeltaTime) override;
 	virtual void OnDestroy(bool AbilityIsEnding) override;
@@ -37,13 +40,34 @@ private:
 	UFUNCTION()
 	void OnCannotInteractChanged();
 
+	bool HasCameraMovedSinceLastScan(const FVector& InLocation, const FVector& InDirection) const;
+	void ScanInteractable(const FVector& InLocation, const FVector& InDirection);
+	void ClearInteractable();
+	void SetCanInteractTag(const bool bInCanInteract);
+
 	bool bIsFinished;
 	float Range;
 	bool bUseCustomDepth;
 
+	float ScanInterval;
+	float ScanMinimumMovementSquared;
+	float ScanMinimumRotationCos;
+	float ScanElapsedTime;
+	float FocusConeAngle;
+
+	FVector LastScanLocation;
+	FVector LastScanDirection;
+	bool bHasScanned;
+
+	bool bIsLocallyControlled;
+	bool bAddedCanInteractTag;
+
 	TWeakObjectPtr<class APECharacter> InteractionOwner;
 	TWeakObjectPtr<AActor> LastInteractableActor_Ref;
 	TWeakObjectPtr<UPrimitiveComponent> LastInteractablePrimitive_Ref;
 
+	TWeakObjectPtr<class UAbilityTask_WaitGameplayTagAdded> WaitCannotInteractAdd_Ref;
+	TWeakObjectPtr<class UAbilityTask_WaitGameplayTagRemoved> WaitCannotInteractRemove_Ref;
+
 	FHitResult HitResult;
 };
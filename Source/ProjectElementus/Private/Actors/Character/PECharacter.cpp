@@ -9,8 +9,11 @@
 #include "GAS/System/PEAbilitySystemComponent.h"
 #include "Components/PEMovementComponent.h"
 #include "Components/PEInventoryComponent.h"
+#include "Components/PECameraOffsetComponent.h"
 #include "Management/Data/PEGlobalTags.h"
 #include "Management/PEProjectSettings.h"
+#include "Management/Subsystems/PERegenerationSubsystem.h"
+#include "Management/Subsystems/PETimingWheelSubsystem.h"
 #include <Management/ElementusInventoryFunctions.h>
 #include <Components/CapsuleComponent.h>
 #include <Components/GameFrameworkComponentManager.h>
@@ -75,6 +78,8 @@ APECharacter::APECharacter(const FObjectInitializer& ObjectInitializer) : Super(
 	FollowCamera->bUsePawnControlRotation = true;
 	FollowCamera->SetRelativeLocation(PECameraDefaultPosition);
 
+	CameraOffset = CreateDefaultSubobject<UPECameraOffsetComponent>(TEXT("CameraOffset"));
+
 	InventoryComponent = CreateDefaultSubobject<UPEInventoryComponent>(APECharacter::PEInventoryComponentName);
 	InventoryComponent->SetIsReplicated(true);
 }
@@ -122,7 +127,7 @@ void APECharacter::OnRep_Controller()
 	if (AbilitySystemComponent.IsValid())
 	{
 		AbilitySystemComponent->RefreshAbilityActorInfo();
-		AbilitySystemComponent->RemoveActiveEffectsWithTags(FGameplayTagContainer(FGameplayTag::RequestGameplayTag(GlobalTag_DeadState)));
+		AbilitySystemComponent->RemoveActiveEffectsWithTags(FGameplayTagContainer(GlobalTag_DeadState));
 	}
 }
 
@@ -219,6 +224,15 @@ void APECharacter::InitializeAbilitySystemComponent(UAbilitySystemComponent* InA
 	AbilitySystemComponent = CastChecked<UPEAbilitySystemComponent>(InABSC);
 	AbilitySystemComponent->InitAbilityActorInfo(InOwnerActor, this);
 
+	// Regeneration is handled by the server: The component will remain registered while its owner (Player State) exists
+	if (HasAuthority())
+	{
+		if (UPERegenerationSubsystem* const Regeneration = UPERegenerationSubsystem::Get(this))
+		{
+			Regeneration->Register(InABSC);
+		}
+	}
+
 	UGameFrameworkComponentManager::SendGameFrameworkComponentExtensionEvent(this, UGameFrameworkComponentManager::NAME_GameActorReady);
 }
 
@@ -264,17 +278,24 @@ void APECharacter::PerformDeath()
 
 	bAlwaysRelevant = false;
 
-	FTimerDelegate TimerDelegate;
-	TimerDelegate.BindLambda([&]
+	constexpr float DestroyDelay = 15.0f;
+
+	if (UPETimingWheelSubsystem* const TimingWheel = UPETimingWheelSubsystem::Get(this))
 	{
-		if (IsValid(this))
+		TimingWheel->Schedule(DestroyDelay, FSimpleDelegate::CreateWeakLambda(this, [this]
 		{
 			Server_PerformDeath();
-		}
-	});
-
-	FTimerHandle TimerHandle;
-	GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, 15.0f, false);
+		}));
+	}
+	else
+	{
+		// The wheel isn't available in every world type: Use a regular timer instead
+		FTimerHandle Handle;
+		GetWorldTimerManager().SetTimer(Handle, FTimerDelegate::CreateWeakLambda(this, [this]
+		{
+			Server_PerformDeath();
+		}), DestroyDelay, false);
+	}
 }
 
 void APECharacter::Server_PerformDeath_Implementation()
@@ -326,7 +347,7 @@ void APECharacter::Landed(const FHitResult& Hit)
 		return;
 	}
 
-	const FGameplayTagContainer DoubleJumpTagContainer{FGameplayTag::RequestGameplayTag("GameplayAbility.Default.DoubleJump")};
+	const FGameplayTagContainer DoubleJumpTagContainer{GlobalTag_Ability_DoubleJump};
 
 	AbilitySystemComponent->CancelAbilities(&DoubleJumpTagContainer);
 }
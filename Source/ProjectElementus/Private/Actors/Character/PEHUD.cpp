@@ -3,6 +3,7 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "Actors/Character/PEHUD.h"
+#include "Management/PEAssetManager.h"
 #include "Management/PEProjectSettings.h"
 #include <Blueprint/UserWidget.h>
 
@@ -20,7 +21,7 @@ void APEHUD::BeginPlay()
 	if (ensureAlwaysMsgf(IsValid(GetOwningPlayerController()), TEXT("%s have a invalid Controller"), *GetName()))
 	{
 		const UPEProjectSettings* const ProjectSettings = GetDefault<UPEProjectSettings>();
-		const TSubclassOf<UUserWidget> UMGHUDClass = ProjectSettings->HUDClass.IsNull() ? nullptr : ProjectSettings->HUDClass.LoadSynchronous();
+		const TSubclassOf<UUserWidget> UMGHUDClass = UPEAssetManager::GetProjectSettingsClass(ProjectSettings->HUDClass);
 
 		if (!IsValid(UMGHUDClass))
 		{
@@ -8,7 +8,9 @@
 #include "Components/PEInventoryComponent.h"
 #include "Management/Data/PEGlobalTags.h"
 #include "Management/Functions/PEEOSLibrary.h"
+#include "Management/PEAssetManager.h"
 #include "Management/PEProjectSettings.h"
+#include "Management/Subsystems/PETimingWheelSubsystem.h"
 #include <Management/ElementusInventoryFunctions.h>
 #include <MFEA_Settings.h>
 #include <EnhancedInputComponent.h>
@@ -51,17 +53,22 @@ void APEPlayerController::InitializeRespawn(const float InSeconds)
 		// If InSeconds is 0, then we want to respawn instantly
 		if (InSeconds > 0.f)
 		{
-			FTimerDelegate TimerDelegate;
-			TimerDelegate.BindLambda([&]
+			if (UPETimingWheelSubsystem* const TimingWheel = UPETimingWheelSubsystem::Get(this))
 			{
-				if (IsValid(this))
+				TimingWheel->Schedule(InSeconds, FSimpleDelegate::CreateWeakLambda(this, [this]
 				{
 					RespawnAndPossess();
-				}
-			});
-
-			FTimerHandle Handle;
-			GetWorld()->GetTimerManager().SetTimer(Handle, TimerDelegate, InSeconds, false);
+				}));
+			}
+			else
+			{
+				// The wheel isn't available in every world type: Use a regular timer instead
+				FTimerHandle Handle;
+				GetWorldTimerManager().SetTimer(Handle, FTimerDelegate::CreateWeakLambda(this, [this]
+				{
+					RespawnAndPossess();
+				}), InSeconds, false);
+			}
 		}
 		else
 		{
@@ -78,7 +85,7 @@ void APEPlayerController::RespawnAndPossess_Implementation()
 		{
 			if (UAbilitySystemComponent* const AbilitySystemComp_Ref = State->GetAbilitySystemComponent())
 			{
-				AbilitySystemComp_Ref->RemoveActiveEffectsWithTags(FGameplayTagContainer(FGameplayTag::RequestGameplayTag(GlobalTag_DeadState)));
+				AbilitySystemComp_Ref->RemoveActiveEffectsWithTags(FGameplayTagContainer(GlobalTag_DeadState));
 			}
 		}
 
@@ -345,7 +352,7 @@ void APEPlayerController::Jump(const FInputActionValue& Value) const
 void APEPlayerController::Client_OpenInventory_Implementation()
 {
 	const UPEProjectSettings* const ProjectSettings = GetDefault<UPEProjectSettings>();
-	const TSubclassOf<UUserWidget> InventoryUIClass = ProjectSettings->MainInventoryWidget.IsNull() ? nullptr : ProjectSettings->MainInventoryWidget.LoadSynchronous();
+	const TSubclassOf<UUserWidget> InventoryUIClass = UPEAssetManager::GetProjectSettingsClass(ProjectSettings->MainInventoryWidget);
 	
 	if (!IsValid(InventoryUIClass))
 	{
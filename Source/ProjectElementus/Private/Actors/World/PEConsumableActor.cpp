@@ -6,6 +6,7 @@
 #include "Actors/Character/PECharacter.h"
 #include "Management/Data/PEConsumableData.h"
 #include "GAS/System/PEAbilitySystemComponent.h"
+#include "Management/Subsystems/PEInteractableSubsystem.h"
 #include <Components/StaticMeshComponent.h>
 #include <NiagaraComponent.h>
 
@@ -26,6 +27,26 @@ APEConsumableActor::APEConsumableActor(const FObjectInitializer& ObjectInitializ
 	ObjectVFX->SetupAttachment(ObjectMesh);
 }
 
+void APEConsumableActor::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UPEInteractableSubsystem* const InteractableSubsystem = UPEInteractableSubsystem::Get(this))
+	{
+		InteractableSubsystem->Register(this);
+	}
+}
+
+void APEConsumableActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UPEInteractableSubsystem* const InteractableSubsystem = UPEInteractableSubsystem::Get(this))
+	{
+		InteractableSubsystem->Unregister(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void APEConsumableActor::PerformConsumption(UAbilitySystemComponent* TargetABSC)
 {
 	if (UPEAbilitySystemComponent* const TargetGASC = Cast<UPEAbilitySystemComponent>(TargetABSC);
@@ -45,6 +45,10 @@ void APEExplosiveActor::PerformExplosion()
 		UNiagaraFunctionLibrary::SpawnSystemAtLocation(GetWorld(), NiagaraSystem, GetActorLocation());
 	}
 
+	// Characters can be hit through multiple components: launch each one only once
+	TArray<UAbilitySystemComponent*, TInlineAllocator<32>> TargetABSCs;
+	TSet<const AActor*, DefaultKeyFuncs<const AActor*>, TInlineSetAllocator<32>> LaunchedCharacters;
+
 	for (const FHitResult& Hit : HitOut)
 	{
 		if (IsValid(Hit.GetActor()))
@@ -53,13 +57,14 @@ void APEExplosiveActor::PerformExplosion()
 
 			if (Hit.GetActor()->GetClass()->IsChildOf<APECharacter>())
 			{
-				if (APECharacter* const Player = Cast<APECharacter>(Hit.GetActor()))
+				if (APECharacter* const Player = Cast<APECharacter>(Hit.GetActor()); Player && !LaunchedCharacters.Contains(Player))
 				{
+					LaunchedCharacters.Add(Player);
 					Player->LaunchCharacter(Velocity, true, true);
 
 					if (ensureAlwaysMsgf(IsValid(Player->GetAbilitySystemComponent()), TEXT("%s have a invalid Ability System Component"), *Player->GetName()))
 					{
-						ApplyExplosibleEffect(Player->GetAbilitySystemComponent());
+						TargetABSCs.Add(Player->GetAbilitySystemComponent());
 					}
 				}
 			}
@@ -72,6 +77,8 @@ void APEExplosiveActor::PerformExplosion()
 		}
 	}
 
+	ApplyExplosibleEffect(TargetABSCs);
+
 	if (bDestroyAfterExplosion)
 	{
 		Destroy();
@@ -82,13 +89,8 @@ void APEExplosiveActor::PerformExplosion()
 	SetReplicates(false);
 }
 
-void APEExplosiveActor::ApplyExplosibleEffect(UAbilitySystemComponent* TargetABSC)
+void APEExplosiveActor::ApplyExplosibleEffect(const TArrayView<UAbilitySystemComponent* const> TargetABSCs)
 {
-	if (UPEAbilitySystemComponent* const TargetGASC = Cast<UPEAbilitySystemComponent>(TargetABSC))
-	{
-		for (const FGameplayEffectGroupedData& Effect : ExplosionEffects)
-		{
-			TargetGASC->ApplyEffectGroupedDataToSelf(Effect);
-		}
-	}
+	// No instigator: Each target stays the source of its own explosion effects, as before batching
+	UPEAbilitySystemComponent::ApplyEffectGroupedDataToTargets(ExplosionEffects, TargetABSCs);
 }
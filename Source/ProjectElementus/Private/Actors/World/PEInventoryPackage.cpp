@@ -4,7 +4,9 @@
 
 #include "Actors/World/PEInventoryPackage.h"
 #include "Actors/Character/PECharacter.h"
+#include "Management/PEAssetManager.h"
 #include "Management/PEProjectSettings.h"
+#include "Management/Subsystems/PEInteractableSubsystem.h"
 #include <Blueprint/UserWidget.h>
 
 APEInventoryPackage::APEInventoryPackage(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
@@ -27,6 +29,26 @@ APEInventoryPackage::APEInventoryPackage(const FObjectInitializer& ObjectInitial
 	}
 }
 
+void APEInventoryPackage::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (UPEInteractableSubsystem* const InteractableSubsystem = UPEInteractableSubsystem::Get(this))
+	{
+		InteractableSubsystem->Register(this);
+	}
+}
+
+void APEInventoryPackage::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UPEInteractableSubsystem* const InteractableSubsystem = UPEInteractableSubsystem::Get(this))
+	{
+		InteractableSubsystem->Unregister(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void APEInventoryPackage::Tick(const float DeltaSeconds)
 {
 	Super::Tick(DeltaSeconds);
@@ -49,7 +71,7 @@ void APEInventoryPackage::DoInteractionBehavior_Implementation(APECharacter* Cha
 	if (APlayerController* const TargetController = CharacterInteracting->GetController<APlayerController>())
 	{
 		const UPEProjectSettings* const ProjectSettings = GetDefault<UPEProjectSettings>();
-		const TSubclassOf<UUserWidget> TradeUIClass = ProjectSettings->TradeInventoryWidget.IsNull() ? nullptr : ProjectSettings->TradeInventoryWidget.LoadSynchronous();
+		const TSubclassOf<UUserWidget> TradeUIClass = UPEAssetManager::GetProjectSettingsClass(ProjectSettings->TradeInventoryWidget);
 
 		if (UUserWidget* const TradeWidget = CreateWidget(TargetController, TradeUIClass))
 		{
@@ -0,0 +1,173 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "Components/PECameraOffsetComponent.h"
+#include "Management/ProjectElementus.h"
+#include <Camera/CameraComponent.h>
+#include <Algo/BinarySearch.h>
+#include <GameFramework/Actor.h>
+
+DECLARE_CYCLE_STAT(TEXT("Camera Offset Tick"), STAT_PECameraOffsetTick, STATGROUP_ProjectElementus);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Camera Offset Requests"), STAT_PECameraOffsetRequests, STATGROUP_ProjectElementus);
+
+UPECameraOffsetComponent::UPECameraOffsetComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UPECameraOffsetComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	TargetCamera = GetOwner()->FindComponentByClass<UCameraComponent>();
+
+	if (TargetCamera.IsValid())
+	{
+		BaseLocation = TargetCamera->GetRelativeLocation();
+	}
+}
+
+int32 UPECameraOffsetComponent::AddOffsetRequest(const FVector& InTargetLocation, const float InBlendTime, const int32 InPriority, FPECameraOffsetBlendFinished&& InOnBlendFinished)
+{
+	if (!TargetCamera.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("%s - Component %s has no camera to move"), *FString(__func__), *GetName());
+		return INDEX_NONE;
+	}
+
+	// Handles are never reused: Stale handles of finished requests are ignored
+	NextHandle = NextHandle == MAX_int32 ? 0 : NextHandle + 1;
+
+	FOffsetRequest NewRequest;
+	NewRequest.Handle = NextHandle;
+	NewRequest.Priority = InPriority;
+	NewRequest.TargetLocation = InTargetLocation;
+	NewRequest.BlendTime = FMath::Max(InBlendTime, 0.f);
+	NewRequest.OnBlendFinished = MoveTemp(InOnBlendFinished);
+
+	const int32 InsertIndex = Algo::UpperBoundBy(Requests, InPriority, &FOffsetRequest::Priority);
+	Requests.Insert(MoveTemp(NewRequest), InsertIndex);
+
+	INC_DWORD_STAT(STAT_PECameraOffsetRequests);
+
+	SetComponentTickEnabled(true);
+
+	return NextHandle;
+}
+
+bool UPECameraOffsetComponent::RevertOffsetRequest(const int32 InHandle)
+{
+	FOffsetRequest* const Request = FindRequest(InHandle);
+	if (!Request)
+	{
+		return false;
+	}
+
+	Request->bReverting = true;
+	SetComponentTickEnabled(true);
+
+	return true;
+}
+
+void UPECameraOffsetComponent::ReleaseOffsetRequest(const int32 InHandle)
+{
+	if (FOffsetRequest* const Request = FindRequest(InHandle))
+	{
+		Request->OnBlendFinished.Unbind();
+		Request->bReverting = true;
+
+		SetComponentTickEnabled(true);
+	}
+}
+
+bool UPECameraOffsetComponent::IsValidOffsetRequest(const int32 InHandle) const
+{
+	return FindRequest(InHandle) != nullptr;
+}
+
+const FVector& UPECameraOffsetComponent::GetBaseLocation() const
+{
+	return BaseLocation;
+}
+
+FVector UPECameraOffsetComponent::GetCurrentLocation() const
+{
+	return TargetCamera.IsValid() ? TargetCamera->GetRelativeLocation() : BaseLocation;
+}
+
+void UPECameraOffsetComponent::TickComponent(const float DeltaTime, const ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PECameraOffsetTick);
+
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Owners are notified after the update, as the callbacks may add or remove requests
+	TArray<TPair<FPECameraOffsetBlendFinished, bool>, TInlineAllocator<4>> FinishedRequests;
+
+	FVector NewLocation = BaseLocation;
+	bool bIsBlending = false;
+
+	for (int32 Iterator = 0; Iterator < Requests.Num();)
+	{
+		FOffsetRequest& Request = Requests[Iterator];
+
+		const float Step = Request.BlendTime > 0.f ? DeltaTime / Request.BlendTime : 1.f;
+		Request.Alpha = FMath::Clamp(Request.bReverting ? Request.Alpha - Step : Request.Alpha + Step, 0.f, 1.f);
+
+		if (Request.bReverting && Request.Alpha <= 0.f)
+		{
+			if (Request.OnBlendFinished.IsBound())
+			{
+				FinishedRequests.Emplace(MoveTemp(Request.OnBlendFinished), true);
+			}
+
+			Requests.RemoveAt(Iterator, 1, false);
+			DEC_DWORD_STAT(STAT_PECameraOffsetRequests);
+
+			continue;
+		}
+
+		if (!Request.bReverting && Request.Alpha >= 1.f && !Request.bNotifiedMove)
+		{
+			Request.bNotifiedMove = true;
+
+			if (Request.OnBlendFinished.IsBound())
+			{
+				FinishedRequests.Emplace(Request.OnBlendFinished, false);
+			}
+		}
+
+		bIsBlending |= Request.bReverting || Request.Alpha < 1.f;
+
+		NewLocation = FMath::Lerp(NewLocation, Request.TargetLocation, Request.Alpha);
+		++Iterator;
+	}
+
+	if (TargetCamera.IsValid())
+	{
+		TargetCamera->SetRelativeLocation(NewLocation);
+	}
+
+	// Settled requests hold the camera in place: No need to keep ticking until a request changes
+	if (!bIsBlending)
+	{
+		SetComponentTickEnabled(false);
+	}
+
+	for (const TPair<FPECameraOffsetBlendFinished, bool>& FinishedRequest : FinishedRequests)
+	{
+		FinishedRequest.Key.ExecuteIfBound(FinishedRequest.Value);
+	}
+}
+
+UPECameraOffsetComponent::FOffsetRequest* UPECameraOffsetComponent::FindRequest(const int32 InHandle)
+{
+	return InHandle == INDEX_NONE ? nullptr : Requests.FindByPredicate([InHandle](const FOffsetRequest& Request) { return Request.Handle == InHandle; });
+}
+
+const UPECameraOffsetComponent::FOffsetRequest* UPECameraOffsetComponent::FindRequest(const int32 InHandle) const
+{
+	return InHandle == INDEX_NONE ? nullptr : Requests.FindByPredicate([InHandle](const FOffsetRequest& Request) { return Request.Handle == InHandle; });
+}
@@ -4,11 +4,235 @@
 
 #include "GAS/Attributes/PEAttributeBase.h"
 #include "GAS/System/PEAbilitySystemComponent.h"
+#include "Management/PEProjectSettings.h"
+#include "Management/ProjectElementus.h"
+#include <Runtime/Engine/Public/Net/UnrealNetwork.h>
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Quantized Attribute Bytes Sent"), STAT_PEQuantizedAttributeBytes, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Quantized Attribute Values Sent"), STAT_PEQuantizedAttributeValues, STATGROUP_ProjectElementus);
+
+constexpr int32 MaxQuantizedAttributes = 32;
+
+/* Each attribute is stored as its quantized base value followed by its quantized current value */
+constexpr int32 QuantizedValuesPerAttribute = 2;
+
+/* Zigzag encoding: Small negative values are packed as small unsigned values */
+static uint32 EncodeQuantizedValue(const int32 InValue)
+{
+	return static_cast<uint32>(InValue) << 1 ^ static_cast<uint32>(InValue >> 31);
+}
+
+static int32 DecodeQuantizedValue(const uint32 InValue)
+{
+	return static_cast<int32>(InValue >> 1) ^ -static_cast<int32>(InValue & 1u);
+}
+
+/* Last quantized values sent to a connection */
+class FPEQuantizedAttributeBaseState final : public INetDeltaBaseState
+{
+public:
+	TArray<int32> Values;
+
+	virtual bool IsStateEqual(INetDeltaBaseState* OtherState) override
+	{
+		return Values == static_cast<const FPEQuantizedAttributeBaseState*>(OtherState)->Values;
+	}
+};
+
+bool FPEQuantizedAttributeState::NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
+{
+	// There's no object reference to be mapped
+	if (DeltaParams.GatherGuidReferences || DeltaParams.MoveGuidToUnmapped)
+	{
+		return false;
+	}
+
+	if (DeltaParams.bUpdateUnmappedObjects)
+	{
+		DeltaParams.bOutHasMoreUnmapped = false;
+		return true;
+	}
+
+	if (FBitWriter* const Writer = DeltaParams.Writer)
+	{
+		// Values are read from the owner when sending: Changes below the precision of an attribute produce the same values and aren't sent
+		if (Owner)
+		{
+			Owner->QuantizeAttributes(Values);
+		}
+
+		const FPEQuantizedAttributeBaseState* const OldState = static_cast<const FPEQuantizedAttributeBaseState*>(DeltaParams.OldState);
+
+		const int32 NumAttributes = Values.Num() / QuantizedValuesPerAttribute;
+
+		uint32 DirtyMask = 0u;
+		for (int32 Index = 0; Index < NumAttributes; ++Index)
+		{
+			const int32 BaseIndex = Index * QuantizedValuesPerAttribute;
+			if (!OldState || !OldState->Values.IsValidIndex(BaseIndex + 1) || OldState->Values[BaseIndex] != Values[BaseIndex] || OldState->Values[BaseIndex + 1] != Values[BaseIndex + 1])
+			{
+				DirtyMask |= 1u << Index;
+			}
+		}
+
+		if (DirtyMask == 0u && OldState)
+		{
+			return false;
+		}
+
+		const TSharedPtr<FPEQuantizedAttributeBaseState> NewState = MakeShared<FPEQuantizedAttributeBaseState>();
+		NewState->Values = Values;
+		*DeltaParams.NewState = NewState;
+
+		const int64 StartBits = Writer->GetNumBits();
+
+		Writer->SerializeIntPacked(DirtyMask);
+
+		for (int32 Index = 0; Index < NumAttributes; ++Index)
+		{
+			if (DirtyMask & 1u << Index)
+			{
+				const int32 BaseIndex = Index * QuantizedValuesPerAttribute;
+
+				// The current value is sent as a delta from the base value: Attributes without active modifiers only add a single byte
+				uint32 EncodedBaseValue = EncodeQuantizedValue(Values[BaseIndex]);
+				uint32 EncodedCurrentDelta = EncodeQuantizedValue(Values[BaseIndex + 1] - Values[BaseIndex]);
+
+				Writer->SerializeIntPacked(EncodedBaseValue);
+				Writer->SerializeIntPacked(EncodedCurrentDelta);
+
+				INC_DWORD_STAT(STAT_PEQuantizedAttributeValues);
+			}
+		}
+
+		INC_DWORD_STAT_BY(STAT_PEQuantizedAttributeBytes, (Writer->GetNumBits() - StartBits + 7) / 8);
+
+		return true;
+	}
+
+	if (FBitReader* const Reader = DeltaParams.Reader)
+	{
+		uint32 DirtyMask = 0u;
+		Reader->SerializeIntPacked(DirtyMask);
+
+		for (int32 Index = 0; Index < MaxQuantizedAttributes && !Reader->IsError(); ++Index)
+		{
+			if (!(DirtyMask & 1u << Index))
+			{
+				continue;
+			}
+
+			uint32 EncodedBaseValue = 0u;
+			Reader->SerializeIntPacked(EncodedBaseValue);
+
+			uint32 EncodedCurrentDelta = 0u;
+			Reader->SerializeIntPacked(EncodedCurrentDelta);
+
+			const int32 BaseIndex = Index * QuantizedValuesPerAttribute;
+			if (Values.Num() <= BaseIndex + 1)
+			{
+				Values.SetNumZeroed(BaseIndex + QuantizedValuesPerAttribute);
+			}
+
+			Values[BaseIndex] = DecodeQuantizedValue(EncodedBaseValue);
+			Values[BaseIndex + 1] = Values[BaseIndex] + DecodeQuantizedValue(EncodedCurrentDelta);
+		}
+
+		if (Reader->IsError())
+		{
+			return false;
+		}
+
+		if (Owner)
+		{
+			Owner->ApplyQuantizedAttributes(Values, DirtyMask);
+		}
+	}
+
+	return true;
+}
+
 
 UPEAttributeBase::UPEAttributeBase(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {	
 }
 
+void UPEAttributeBase::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	QuantizedAttributes.Owner = this;
+}
+
+void UPEAttributeBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	if (IsUsingQuantizedReplication())
+	{
+		DOREPLIFETIME(UPEAttributeBase, QuantizedAttributes);
+	}
+	else
+	{
+		DISABLE_REPLICATED_PROPERTY(UPEAttributeBase, QuantizedAttributes);
+	}
+}
+
+bool UPEAttributeBase::IsUsingQuantizedReplication()
+{
+	return GetDefault<UPEProjectSettings>()->bQuantizedAttributeReplication;
+}
+
+TArrayView<const FPEQuantizedAttribute> UPEAttributeBase::GetQuantizedAttributes() const
+{
+	return TArrayView<const FPEQuantizedAttribute>();
+}
+
+void UPEAttributeBase::QuantizeAttributes(TArray<int32>& OutValues)
+{
+	const TArrayView<const FPEQuantizedAttribute> Attributes = GetQuantizedAttributes();
+	const int32 NumAttributes = FMath::Min(Attributes.Num(), MaxQuantizedAttributes);
+
+	OutValues.SetNumUninitialized(NumAttributes * QuantizedValuesPerAttribute);
+
+	// Current values are replicated too: Simulated proxies of Mixed and Minimal components don't receive the active effects to calculate them
+	for (int32 Index = 0; Index < NumAttributes; ++Index)
+	{
+		const FGameplayAttributeData* const AttributeData = Attributes[Index].Attribute.GetGameplayAttributeData(this);
+		const int32 BaseIndex = Index * QuantizedValuesPerAttribute;
+
+		OutValues[BaseIndex] = AttributeData ? FMath::RoundToInt32(AttributeData->GetBaseValue() / Attributes[Index].Precision) : 0;
+		OutValues[BaseIndex + 1] = AttributeData ? FMath::RoundToInt32(AttributeData->GetCurrentValue() / Attributes[Index].Precision) : 0;
+	}
+}
+
+void UPEAttributeBase::ApplyQuantizedAttributes(const TArray<int32>& InValues, const uint32 InMask)
+{
+	const TArrayView<const FPEQuantizedAttribute> Attributes = GetQuantizedAttributes();
+	UAbilitySystemComponent* const AbilityComp = GetOwningAbilitySystemComponent();
+
+	for (int32 Index = 0; Index < FMath::Min3(Attributes.Num(), InValues.Num() / QuantizedValuesPerAttribute, MaxQuantizedAttributes); ++Index)
+	{
+		FGameplayAttributeData* const AttributeData = Attributes[Index].Attribute.GetGameplayAttributeData(this);
+		if (!(InMask & 1u << Index) || !AttributeData)
+		{
+			continue;
+		}
+
+		const FGameplayAttributeData OldValue = *AttributeData;
+		const int32 BaseIndex = Index * QuantizedValuesPerAttribute;
+
+		AttributeData->SetBaseValue(InValues[BaseIndex] * Attributes[Index].Precision);
+		AttributeData->SetCurrentValue(InValues[BaseIndex + 1] * Attributes[Index].Precision);
+
+		// Same as GAMEPLAYATTRIBUTE_REPNOTIFY: Clients with the active effects recalculate the current value, the others keep the replicated one
+		if (AbilityComp)
+		{
+			AbilityComp->SetBaseAttributeValueFromReplication(Attributes[Index].Attribute, *AttributeData, OldValue);
+		}
+	}
+}
+
 void UPEAttributeBase::AdjustAttributeForMaxChange(const FGameplayAttributeData& AffectedAttribute, const FGameplayAttributeData& MaxAttribute, const float NewMaxValue, const FGameplayAttribute& AffectedAttributeProperty) const
 {
 	if (UAbilitySystemComponent* const AbilityComp = GetOwningAbilitySystemComponent())
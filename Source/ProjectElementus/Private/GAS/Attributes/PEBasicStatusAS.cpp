@@ -3,7 +3,9 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "GAS/Attributes/PEBasicStatusAS.h"
+#include "GAS/System/PEGASProfiler.h"
 #include "Management/Data/PEGlobalTags.h"
+#include "Management/PEAssetManager.h"
 #include "Management/PEProjectSettings.h"
 #include <AbilitySystemComponent.h>
 #include <GameplayEffectTypes.h>
@@ -21,6 +23,8 @@ UPEBasicStatusAS::UPEBasicStatusAS(const FObjectInitializer& ObjectInitializer)
 
 void UPEBasicStatusAS::PreAttributeChange(const FGameplayAttribute& Attribute, float& NewValue)
 {
+	PE_GAS_PROFILE_SCOPE(PreAttributeChange, GetClass());
+
 	Super::PreAttributeChange(Attribute, NewValue);
 
 	// Check which attribute is being modified and clamp it with AdjustAttributeForMaxChange function
@@ -40,6 +44,8 @@ void UPEBasicStatusAS::PreAttributeChange(const FGameplayAttribute& Attribute, f
 
 void UPEBasicStatusAS::PostAttributeChange(const FGameplayAttribute& Attribute, const float OldValue, const float NewValue)
 {
+	PE_GAS_PROFILE_SCOPE(PostAttributeChange, GetClass());
+
 	Super::PostAttributeChange(Attribute, OldValue, NewValue);
 
 	if (NewValue <= 0.f)
@@ -50,7 +56,7 @@ void UPEBasicStatusAS::PostAttributeChange(const FGameplayAttribute& Attribute,
 			GetOwningAbilitySystemComponentChecked()->CancelAllAbilities();
 
 			const UPEProjectSettings* const ProjectSettings = GetDefault<UPEProjectSettings>();
-			const TSubclassOf<UGameplayEffect> DeathEffectClass = ProjectSettings->GlobalDeathEffect.IsNull() ? nullptr : ProjectSettings->GlobalDeathEffect.LoadSynchronous();
+			const TSubclassOf<UGameplayEffect> DeathEffectClass = UPEAssetManager::GetProjectSettingsClass(ProjectSettings->GlobalDeathEffect);
 
 			if (!IsValid(DeathEffectClass))
 			{
@@ -67,7 +73,7 @@ void UPEBasicStatusAS::PostAttributeChange(const FGameplayAttribute& Attribute,
 		// If stamina is 0 or less, cancel abilities that use stamina
 		if (Attribute == GetStaminaAttribute())
 		{
-			const FGameplayTagContainer StaminaCostTagContainer{ FGameplayTag::RequestGameplayTag(GlobalTag_CostWhileActive_Stamina) };
+			const FGameplayTagContainer StaminaCostTagContainer{ GlobalTag_CostWhileActive_Stamina };
 
 			GetOwningAbilitySystemComponentChecked()->CancelAbilities(&StaminaCostTagContainer);
 		}
@@ -75,7 +81,7 @@ void UPEBasicStatusAS::PostAttributeChange(const FGameplayAttribute& Attribute,
 		// If mana is 0 or less, cancel abilities that use mana
 		if (Attribute == GetManaAttribute())
 		{
-			const FGameplayTagContainer ManaCostTagContainer{ FGameplayTag::RequestGameplayTag(GlobalTag_CostWhileActive_Mana) };
+			const FGameplayTagContainer ManaCostTagContainer{ GlobalTag_CostWhileActive_Mana };
 
 			GetOwningAbilitySystemComponentChecked()->CancelAbilities(&ManaCostTagContainer);
 		}
@@ -84,6 +90,8 @@ void UPEBasicStatusAS::PostAttributeChange(const FGameplayAttribute& Attribute,
 
 void UPEBasicStatusAS::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
+	PE_GAS_PROFILE_SCOPE(PostGameplayEffectExecute, Data.EffectSpec.Def ? Data.EffectSpec.Def->GetClass() : nullptr);
+
 	Super::PostGameplayEffectExecute(Data);
 
 	// Check if the effect is a damage effect and apply it to decrease the health
@@ -121,12 +129,26 @@ void UPEBasicStatusAS::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UPEBasicStatusAS, Health, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPEBasicStatusAS, MaxHealth, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPEBasicStatusAS, Mana, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPEBasicStatusAS, MaxMana, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPEBasicStatusAS, Stamina, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPEBasicStatusAS, MaxStamina, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_ATTRIBUTE(UPEBasicStatusAS, Health);
+	DOREPLIFETIME_ATTRIBUTE(UPEBasicStatusAS, MaxHealth);
+	DOREPLIFETIME_ATTRIBUTE(UPEBasicStatusAS, Mana);
+	DOREPLIFETIME_ATTRIBUTE(UPEBasicStatusAS, MaxMana);
+	DOREPLIFETIME_ATTRIBUTE(UPEBasicStatusAS, Stamina);
+	DOREPLIFETIME_ATTRIBUTE(UPEBasicStatusAS, MaxStamina);
+}
+
+TArrayView<const FPEQuantizedAttribute> UPEBasicStatusAS::GetQuantizedAttributes() const
+{
+	static const FPEQuantizedAttribute Attributes[] = {
+		{ GetHealthAttribute(), 0.1f },
+		{ GetMaxHealthAttribute(), 0.1f },
+		{ GetStaminaAttribute(), 0.1f },
+		{ GetMaxStaminaAttribute(), 0.1f },
+		{ GetManaAttribute(), 0.1f },
+		{ GetMaxManaAttribute(), 0.1f }
+	};
+
+	return Attributes;
 }
 
 void UPEBasicStatusAS::OnRep_Health(const FGameplayAttributeData& OldValue) const
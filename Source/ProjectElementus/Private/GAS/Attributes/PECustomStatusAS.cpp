@@ -3,6 +3,7 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "GAS/Attributes/PECustomStatusAS.h"
+#include "GAS/System/PEGASProfiler.h"
 #include "Actors/Character/PECharacter.h"
 #include <GameFramework/PlayerState.h>
 #include <GameFramework/CharacterMovementComponent.h>
@@ -20,6 +21,8 @@ UPECustomStatusAS::UPECustomStatusAS(const FObjectInitializer& ObjectInitializer
 
 void UPECustomStatusAS::PostAttributeChange(const FGameplayAttribute& Attribute, const float OldValue, const float NewValue)
 {
+	PE_GAS_PROFILE_SCOPE(PostAttributeChange, GetClass());
+
 	Super::PostAttributeChange(Attribute, OldValue, NewValue);
 
 	if (Attribute == GetSpeedRateAttribute() || Attribute == GetJumpRateAttribute())
@@ -52,11 +55,24 @@ void UPECustomStatusAS::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UPECustomStatusAS, AttackRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPECustomStatusAS, DefenseRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPECustomStatusAS, SpeedRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPECustomStatusAS, JumpRate, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPECustomStatusAS, Gold, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_ATTRIBUTE(UPECustomStatusAS, AttackRate);
+	DOREPLIFETIME_ATTRIBUTE(UPECustomStatusAS, DefenseRate);
+	DOREPLIFETIME_ATTRIBUTE(UPECustomStatusAS, SpeedRate);
+	DOREPLIFETIME_ATTRIBUTE(UPECustomStatusAS, JumpRate);
+	DOREPLIFETIME_ATTRIBUTE(UPECustomStatusAS, Gold);
+}
+
+TArrayView<const FPEQuantizedAttribute> UPECustomStatusAS::GetQuantizedAttributes() const
+{
+	static const FPEQuantizedAttribute Attributes[] = {
+		{ GetAttackRateAttribute(), 0.01f },
+		{ GetDefenseRateAttribute(), 0.01f },
+		{ GetSpeedRateAttribute(), 0.01f },
+		{ GetJumpRateAttribute(), 0.01f },
+		{ GetGoldAttribute(), 1.f }
+	};
+
+	return Attributes;
 }
 
 void UPECustomStatusAS::OnRep_AttackRate(const FGameplayAttributeData& OldValue) const
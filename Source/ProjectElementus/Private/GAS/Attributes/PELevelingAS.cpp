@@ -3,10 +3,11 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "GAS/Attributes/PELevelingAS.h"
+#include "GAS/System/PEGASProfiler.h"
 #include "GAS/Attributes/PEBasicStatusAS.h"
 #include "GAS/Attributes/PECustomStatusAS.h"
-#include "GAS/System/PEAttributeData.h"
 #include <AbilitySystemComponent.h>
+#include <GameplayEffect.h>
 #include <GameplayEffectExtension.h>
 #include <GameplayEffectTypes.h>
 #include <Runtime/Engine/Public/Net/UnrealNetwork.h>
@@ -26,36 +27,134 @@ UPELevelingAS::UPELevelingAS(const FObjectInitializer& ObjectInitializer) : Supe
 	}
 }
 
+void UPELevelingAS::BuildLevelingTable(const UDataTable* InTable, TArray<FPELevelingData>& OutLevelingTable)
+{
+	OutLevelingTable.Reset();
+
+	if (!IsValid(InTable))
+	{
+		return;
+	}
+
+	// Rows are named by the level they grant: Missing rows will be kept with no bonus and no required experience
+	InTable->ForeachRow<FPELevelingData>(FString(__func__), [&OutLevelingTable](const FName& RowName, const FPELevelingData& Row)
+	{
+		if (int32 Level = INDEX_NONE; LexTryParseString(Level, *RowName.ToString()) && Level > 0)
+		{
+			if (OutLevelingTable.Num() <= Level)
+			{
+				OutLevelingTable.SetNum(Level + 1);
+			}
+
+			OutLevelingTable[Level] = Row;
+		}
+	});
+}
+
+void UPELevelingAS::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		LevelingTable = GetDefault<UPELevelingAS>()->LevelingTable;
+	}
+
+	// The table is loaded once when the default object is initialized and shared with the instances
+	if (!LevelingTable.IsValid() && !LevelingBonusData.IsNull())
+	{
+		TArray<FPELevelingData> NewLevelingTable;
+		BuildLevelingTable(LevelingBonusData.LoadSynchronous(), NewLevelingTable);
+
+		LevelingTable = MakeShared<const TArray<FPELevelingData>>(MoveTemp(NewLevelingTable));
+	}
+}
+
 void UPELevelingAS::PostAttributeChange(const FGameplayAttribute& Attribute, const float OldValue, const float NewValue)
 {
+	PE_GAS_PROFILE_SCOPE(PostAttributeChange, GetClass());
+
 	Super::PostAttributeChange(Attribute, OldValue, NewValue);
 
-	if (Attribute == GetCurrentExperienceAttribute() && NewValue >= GetRequiredExperience() && !LevelingBonusData.IsNull())
+	if (Attribute != GetCurrentExperienceAttribute() || NewValue < GetRequiredExperience() || !LevelingTable.IsValid())
 	{
-		UAbilitySystemComponent* const AbilityComp = GetOwningAbilitySystemComponentChecked();
+		return;
+	}
+
+	const TArray<FPELevelingData>& LevelingRows = *LevelingTable;
+
+	float NewLevel = GetCurrentLevel();
+	float NewExperience = NewValue;
+	float NewRequiredExperience = GetRequiredExperience();
 
-		// This block will verify if the leveling bonus table exists and modify
-		// the attributes accordingly the current (new) level
-		if (const UDataTable* const LevelingBonus_Table = LevelingBonusData.LoadSynchronous())
+	FPELevelingData SummedBonus;
+
+	// Resolve all level ups granted by this change in a single pass
+	while (NewExperience >= NewRequiredExperience)
+	{
+		const int32 NextLevel = FMath::TruncToInt32(NewLevel) + 1;
+		if (!LevelingRows.IsValidIndex(NextLevel))
 		{
-			const FPELevelingData LevelingInfo = *LevelingBonus_Table->FindRow<FPELevelingData>(*FString::FromInt(GetCurrentLevel() + 1), FString());
+			break;
+		}
 
-			if constexpr (&LevelingInfo != nullptr)
-			{
-				AbilityComp->ApplyModToAttribute(UPEBasicStatusAS::GetMaxHealthAttribute(), EGameplayModOp::Additive, LevelingInfo.BonusMaxHealth);
-				AbilityComp->ApplyModToAttribute(UPEBasicStatusAS::GetMaxStaminaAttribute(), EGameplayModOp::Additive, LevelingInfo.BonusMaxStamina);
-				AbilityComp->ApplyModToAttribute(UPEBasicStatusAS::GetMaxManaAttribute(), EGameplayModOp::Additive, LevelingInfo.BonusMaxMana);
+		const FPELevelingData& LevelingInfo = LevelingRows[NextLevel];
 
-				AbilityComp->ApplyModToAttribute(UPECustomStatusAS::GetAttackRateAttribute(), EGameplayModOp::Additive, LevelingInfo.BonusAttackRate);
-				AbilityComp->ApplyModToAttribute(UPECustomStatusAS::GetDefenseRateAttribute(), EGameplayModOp::Additive, LevelingInfo.BonusDefenseRate);
+		SummedBonus.BonusMaxHealth += LevelingInfo.BonusMaxHealth;
+		SummedBonus.BonusMaxStamina += LevelingInfo.BonusMaxStamina;
+		SummedBonus.BonusMaxMana += LevelingInfo.BonusMaxMana;
+		SummedBonus.BonusAttackRate += LevelingInfo.BonusAttackRate;
+		SummedBonus.BonusDefenseRate += LevelingInfo.BonusDefenseRate;
 
-				const float NewExperience = GetCurrentExperience() - GetRequiredExperience();
-				SetRequiredExperience(LevelingInfo.RequiredExp);
-				SetCurrentLevel(GetCurrentLevel() + 1);
-				SetCurrentExperience(NewExperience);
-			}
+		NewExperience -= NewRequiredExperience;
+		NewRequiredExperience = LevelingInfo.RequiredExp;
+		NewLevel += 1.f;
+
+		// A row without required experience is the last level
+		if (NewRequiredExperience <= 0.f)
+		{
+			break;
+		}
+	}
+
+	if (NewLevel == GetCurrentLevel())
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* const AbilityComp = GetOwningAbilitySystemComponentChecked();
+
+	// Apply all bonuses with a single instant effect instead of a modification per attribute and level
+	UGameplayEffect* const LevelingBonusEffect = NewObject<UGameplayEffect>(GetTransientPackage());
+	LevelingBonusEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	const auto AddBonusModifier = [LevelingBonusEffect](const FGameplayAttribute& InAttribute, const float InMagnitude)
+	{
+		if (FMath::IsNearlyZero(InMagnitude))
+		{
+			return;
 		}
+
+		FGameplayModifierInfo& ModifierInfo = LevelingBonusEffect->Modifiers.AddDefaulted_GetRef();
+		ModifierInfo.Attribute = InAttribute;
+		ModifierInfo.ModifierOp = EGameplayModOp::Additive;
+		ModifierInfo.ModifierMagnitude = FScalableFloat(InMagnitude);
+	};
+
+	AddBonusModifier(UPEBasicStatusAS::GetMaxHealthAttribute(), SummedBonus.BonusMaxHealth);
+	AddBonusModifier(UPEBasicStatusAS::GetMaxStaminaAttribute(), SummedBonus.BonusMaxStamina);
+	AddBonusModifier(UPEBasicStatusAS::GetMaxManaAttribute(), SummedBonus.BonusMaxMana);
+	AddBonusModifier(UPECustomStatusAS::GetAttackRateAttribute(), SummedBonus.BonusAttackRate);
+	AddBonusModifier(UPECustomStatusAS::GetDefenseRateAttribute(), SummedBonus.BonusDefenseRate);
+
+	if (!LevelingBonusEffect->Modifiers.IsEmpty())
+	{
+		AbilityComp->ApplyGameplayEffectToSelf(LevelingBonusEffect, 1.f, AbilityComp->MakeEffectContext());
 	}
+
+	SetRequiredExperience(NewRequiredExperience);
+	SetCurrentLevel(NewLevel);
+	SetCurrentExperience(NewExperience);
 }
 
 #pragma region Attribute Replication
@@ -63,9 +162,20 @@ void UPELevelingAS::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLif
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UPELevelingAS, CurrentLevel, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPELevelingAS, CurrentExperience, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UPELevelingAS, RequiredExperience, COND_None, REPNOTIFY_Always);
+	DOREPLIFETIME_ATTRIBUTE(UPELevelingAS, CurrentLevel);
+	DOREPLIFETIME_ATTRIBUTE(UPELevelingAS, CurrentExperience);
+	DOREPLIFETIME_ATTRIBUTE(UPELevelingAS, RequiredExperience);
+}
+
+TArrayView<const FPEQuantizedAttribute> UPELevelingAS::GetQuantizedAttributes() const
+{
+	static const FPEQuantizedAttribute Attributes[] = {
+		{ GetCurrentLevelAttribute(), 1.f },
+		{ GetCurrentExperienceAttribute(), 1.f },
+		{ GetRequiredExperienceAttribute(), 1.f }
+	};
+
+	return Attributes;
 }
 
 void UPELevelingAS::OnRep_CurrentLevel(const FGameplayAttributeData& OldValue) const
@@ -5,8 +5,17 @@
 #include "GAS/Effects/PEDamageGEC.h"
 #include "GAS/Attributes/PEBasicStatusAS.h"
 #include "GAS/Attributes/PECustomStatusAS.h"
+#include "GAS/System/PEEffectContext.h"
 #include "Management/Data/PEGlobalTags.h"
+#include "Management/ProjectElementus.h"
 #include <AbilitySystemComponent.h>
+#include <Math/VectorRegister.h>
+
+DECLARE_CYCLE_STAT(TEXT("Damage Batch Kernel"), STAT_PEDamageBatchKernel, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Damage Batch Targets"), STAT_PEDamageBatchTargets, STATGROUP_ProjectElementus);
+
+// Lower bound of the damage divisor: A zero defense rate would output inf/NaN damage
+constexpr float MinDefenseRate = UE_KINDA_SMALL_NUMBER;
 
 struct FDamageAttributesStatics
 {
@@ -48,27 +57,85 @@ void UPEDamageGEC::Execute_Implementation(const FGameplayEffectCustomExecutionPa
 
 	float BaseDamage = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(GetAttributesStatics().DamageDef, EvaluationParameters, BaseDamage);
-	BaseDamage += FMath::Max<float>(Spec.GetSetByCallerMagnitude(FGameplayTag::RequestGameplayTag(GlobalTag_Damage), false, -1.0f), 0.0f);
+	BaseDamage += FMath::Max<float>(Spec.GetSetByCallerMagnitude(GlobalTag_Damage, false, -1.0f), 0.0f);
 
 	float AttackRate = 0.f;
 	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(GetAttributesStatics().AttackRateDef, EvaluationParameters, AttackRate);
 	AttackRate = FMath::Max<float>(AttackRate, 0.0f);
 
 	float DefenseRate = 0.f;
-	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(GetAttributesStatics().AttackRateDef, EvaluationParameters, DefenseRate);
+	ExecutionParams.AttemptCalculateCapturedAttributeMagnitude(GetAttributesStatics().DefenseRateDef, EvaluationParameters, DefenseRate);
 	DefenseRate = FMath::Max<float>(DefenseRate, 0.0f);
 
-	const auto CalculateDamage = [&BaseDamage, &AttackRate, &DefenseRate]() -> float
+	// Each target has its own stream to keep the result independent of the application order
+	const int32 Seed = MakeDamageSeed(Spec, ExecutionParams.GetTargetAbilitySystemComponent());
+
+	float DamageDone = 0.f;
+	CalculateDamageBatch(MakeArrayView(&BaseDamage, 1), MakeArrayView(&AttackRate, 1), MakeArrayView(&DefenseRate, 1), MakeArrayView(&Seed, 1), MakeArrayView(&DamageDone, 1));
+
+	OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(GetAttributesStatics().DamageProperty, EGameplayModOp::Additive, DamageDone));
+}
+
+void UPEDamageGEC::CalculateDamageBatch(const TArrayView<const float> BaseDamage, const TArrayView<const float> AttackRate, const TArrayView<const float> DefenseRate, const TArrayView<const int32> Seeds, const TArrayView<float> OutDamage)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PEDamageBatchKernel);
+
+	const int32 NumTargets = BaseDamage.Num();
+	check(AttackRate.Num() == NumTargets && DefenseRate.Num() == NumTargets && Seeds.Num() == NumTargets && OutDamage.Num() == NumTargets);
+
+	INC_DWORD_STAT_BY(STAT_PEDamageBatchTargets, NumTargets);
+
+	// Each random value only depends on the seed of its target: The batch matches the single target execution
+	TArray<float, TInlineAllocator<64>> RandomFractions;
+	RandomFractions.SetNumUninitialized(NumTargets);
+
+	for (int32 Index = 0; Index < NumTargets; ++Index)
+	{
+		RandomFractions[Index] = FRandomStream(Seeds[Index]).GetFraction();
+	}
+
+	// Damage = |BaseDamage + AttackRate / DefenseRate * FRandRange(1, BaseDamage)|
+	const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+	const VectorRegister4Float MinDefense = VectorSetFloat1(MinDefenseRate);
+	const int32 NumVectorized = NumTargets & ~3;
+
+	for (int32 Index = 0; Index < NumVectorized; Index += 4)
 	{
-		float DamageDone = BaseDamage + AttackRate / DefenseRate * FMath::FRandRange(1.f, BaseDamage);
+		const VectorRegister4Float Base = VectorLoad(&BaseDamage[Index]);
+		const VectorRegister4Float Attack = VectorLoad(&AttackRate[Index]);
+		const VectorRegister4Float Defense = VectorMax(VectorLoad(&DefenseRate[Index]), MinDefense);
+		const VectorRegister4Float Fraction = VectorLoad(&RandomFractions[Index]);
 
-		if (DamageDone < 0.f)
-		{
-			DamageDone *= -1.f;
-		}
+		const VectorRegister4Float RandomRange = VectorMultiplyAdd(Fraction, VectorSubtract(Base, One), One);
+		const VectorRegister4Float Damage = VectorMultiplyAdd(VectorDivide(Attack, Defense), RandomRange, Base);
 
-		return DamageDone;
-	};
+		VectorStore(VectorAbs(Damage), &OutDamage[Index]);
+	}
+
+	for (int32 Index = NumVectorized; Index < NumTargets; ++Index)
+	{
+		const float RandomRange = 1.f + RandomFractions[Index] * (BaseDamage[Index] - 1.f);
+		OutDamage[Index] = FMath::Abs(BaseDamage[Index] + AttackRate[Index] / FMath::Max(DefenseRate[Index], MinDefenseRate) * RandomRange);
+	}
+}
+
+int32 UPEDamageGEC::MakeDamageSeed(const FGameplayEffectSpec& Spec, const UAbilitySystemComponent* Target)
+{
+	uint32 Seed = GetTypeHash(IsValid(Spec.Def) ? Spec.Def->GetFName() : NAME_None);
+	Seed = HashCombine(Seed, GetTypeHash(Spec.GetLevel()));
+
+	if (const AActor* const Instigator = Spec.GetEffectContext().GetInstigator())
+	{
+		Seed = HashCombine(Seed, GetTypeHash(Instigator->GetFName()));
+	}
+
+	// Different applications of the same effect use different values
+	Seed = HashCombine(Seed, GetTypeHash(FPEGameplayEffectContext::GetRandomSeed(Spec.GetEffectContext())));
+
+	if (IsValid(Target) && IsValid(Target->GetOwner()))
+	{
+		Seed = HashCombine(Seed, GetTypeHash(Target->GetOwner()->GetFName()));
+	}
 
-	OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(GetAttributesStatics().DamageProperty, EGameplayModOp::Additive, CalculateDamage()));
+	return static_cast<int32>(Seed);
 }
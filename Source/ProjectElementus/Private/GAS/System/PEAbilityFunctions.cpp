@@ -3,6 +3,7 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "GAS/System/PEAbilityFunctions.h"
+#include "GAS/Targeting/PEMultiHitTargetData.h"
 #include <AbilitySystemComponent.h>
 
 FGameplayAbilityTargetDataHandle UPEAbilityFunctions::MakeTargetDataHandleFromSingleHitResult(const FHitResult HitResult)
@@ -28,6 +29,17 @@ FGameplayAbilityTargetDataHandle UPEAbilityFunctions::MakeTargetDataHandleFromHi
 	return TargetData;
 }
 
+FGameplayAbilityTargetDataHandle UPEAbilityFunctions::MakeMultiHitTargetDataHandleFromHitResultArray(const TArray<FHitResult> HitResults)
+{
+	if (!HitResults.IsEmpty())
+	{
+		// A single target data with all hits instead of a single target hit per hit
+		return FGameplayAbilityTargetDataHandle(new FPEGameplayAbilityTargetData_MultiHit(HitResults));
+	}
+
+	return FGameplayAbilityTargetDataHandle();
+}
+
 FGameplayAbilityTargetDataHandle UPEAbilityFunctions::MakeTargetDataHandleFromActorArray(const TArray<AActor*> TargetActors)
 {
 	if (!TargetActors.IsEmpty())
@@ -135,3 +147,13 @@ void UPEAbilityFunctions::RemoveAbility(UAbilitySystemComponent* TargetABSC, con
 		TargetABSC->ClearAbility(AbilitySpec->Handle);
 	}
 }
+
+void UPEAbilityFunctions::SetEffectSetByCallerMagnitude(FGameplayEffectGroupedData& GroupedData, const FGameplayTag Tag, const float Magnitude)
+{
+	GroupedData.SetSetByCallerMagnitude(Tag, Magnitude);
+}
+
+void UPEAbilityFunctions::RemoveEffectSetByCallerMagnitude(FGameplayEffectGroupedData& GroupedData, const FGameplayTag Tag)
+{
+	GroupedData.RemoveSetByCallerMagnitude(Tag);
+}
@@ -5,12 +5,41 @@
 #include "GAS/System/PEAbilitySystemComponent.h"
 #include "GAS/System/PEAbilityData.h"
 #include "GAS/System/PEEffectData.h"
-#include "GAS/Attributes/PEBasicStatusAS.h"
-#include "GAS/Attributes/PECustomStatusAS.h"
-#include "GAS/Attributes/PELevelingAS.h"
+#include "GAS/System/PEGASProfiler.h"
+#include "GAS/System/PEGameplayAbility.h"
+#include "GAS/Targeting/PEPooledTargetActor.h"
 #include "ViewModels/Attributes/PEVM_AttributeBasic.h"
 #include "ViewModels/Attributes/PEVM_AttributeCustom.h"
 #include "ViewModels/Attributes/PEVM_AttributeLeveling.h"
+#include "Management/ProjectElementus.h"
+#include <Abilities/GameplayAbilityTargetActor.h>
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effect Spec Template Hits"), STAT_PEEffectSpecTemplateHits, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effect Spec Template Misses"), STAT_PEEffectSpecTemplateMisses, STATGROUP_ProjectElementus);
+
+constexpr int32 MaxPooledTargetActors = 4;
+constexpr int32 MaxEffectSpecTemplates = 64;
+
+/* Same match rule used by the grouped data removal: all Set by Caller parameters of the grouped data must match the effect values */
+static bool DoesActiveEffectMatchGroupedData(const FActiveGameplayEffect& CurEffect, const FGameplayEffectGroupedData& GroupedData, const UAbilitySystemComponent* InstigatorABSC)
+{
+	bool bMatches = false;
+
+	if (IsValid(CurEffect.Spec.Def) && GroupedData.EffectClass == CurEffect.Spec.Def->GetClass() && InstigatorABSC == CurEffect.Spec.GetEffectContext().GetInstigatorAbilitySystemComponent())
+	{
+		for (const TPair<FGameplayTag, float>& Iterator : GroupedData.GetSetByCallerData())
+		{
+			bMatches = CurEffect.Spec.SetByCallerTagMagnitudes.FindRef(Iterator.Key) == Iterator.Value;
+
+			if (!bMatches)
+			{
+				break;
+			}
+		}
+	}
+
+	return bMatches;
+}
 
 UPEAbilitySystemComponent::UPEAbilitySystemComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
@@ -22,85 +51,169 @@ UPEAbilitySystemComponent::UPEAbilitySystemComponent(const FObjectInitializer& O
 	LevelingAttributes_VM = CreateDefaultSubobject<UPEVM_AttributeLeveling>(TEXT("LevelingAttributes_ViewModel"));
 }
 
-void UPEAbilitySystemComponent::ApplyEffectGroupedDataToSelf(const FGameplayEffectGroupedData GroupedData)
+FActiveGameplayEffectHandle UPEAbilitySystemComponent::ApplyGameplayEffectSpecToSelf(const FGameplayEffectSpec& GameplayEffect, const FPredictionKey PredictionKey)
+{
+	PE_GAS_PROFILE_SCOPE(ApplyEffectSpec, GameplayEffect.Def ? GameplayEffect.Def->GetClass() : nullptr);
+
+	return Super::ApplyGameplayEffectSpecToSelf(GameplayEffect, PredictionKey);
+}
+
+void UPEAbilitySystemComponent::ApplyEffectGroupedDataToSelf(const FGameplayEffectGroupedData& GroupedData)
 {
+	PE_GAS_PROFILE_SCOPE(ApplyEffectGroupedData, GroupedData.EffectClass.Get());
+
 	if (!IsOwnerActorAuthoritative())
 	{
 		return;
 	}
 
-	const FGameplayEffectSpecHandle& SpecHandle = MakeOutgoingSpec(GroupedData.EffectClass, 1.f, MakeEffectContext());
-
-	for (const TPair<FGameplayTag, float>& StackedData : GroupedData.SetByCallerStackedData)
+	if (const FGameplayEffectSpec* const SpecTemplate = FindOrAddEffectSpecTemplate(GroupedData))
 	{
-		SpecHandle.Data.Get()->SetSetByCallerMagnitude(StackedData.Key, StackedData.Value);
-	}
+		FGameplayEffectSpec Spec(*SpecTemplate);
+		Spec.SetContext(MakeEffectContext());
+		Spec.CaptureDataFromSource(true);
 
-	if (SpecHandle.IsValid())
-	{
-		ApplyGameplayEffectSpecToSelf(*SpecHandle.Data);
+		ApplyGameplayEffectSpecToSelf(Spec);
 	}
 }
 
-void UPEAbilitySystemComponent::ApplyEffectGroupedDataToTarget(const FGameplayEffectGroupedData GroupedData, UAbilitySystemComponent* TargetABSC)
+void UPEAbilitySystemComponent::ApplyEffectGroupedDataToTarget(const FGameplayEffectGroupedData& GroupedData, UAbilitySystemComponent* TargetABSC)
 {
+	PE_GAS_PROFILE_SCOPE(ApplyEffectGroupedData, GroupedData.EffectClass.Get());
+
 	if (!IsOwnerActorAuthoritative())
 	{
 		return;
 	}
 
-	const FGameplayEffectSpecHandle& SpecHandle = MakeOutgoingSpec(GroupedData.EffectClass, 1.f, MakeEffectContext());
-
-	for (const TPair<FGameplayTag, float>& StackedData : GroupedData.SetByCallerStackedData)
+	if (const FGameplayEffectSpec* const SpecTemplate = FindOrAddEffectSpecTemplate(GroupedData))
 	{
-		SpecHandle.Data.Get()->SetSetByCallerMagnitude(StackedData.Key, StackedData.Value);
-	}
+		FGameplayEffectSpec Spec(*SpecTemplate);
+		Spec.SetContext(MakeEffectContext());
+		Spec.CaptureDataFromSource(true);
 
-	if (SpecHandle.IsValid())
-	{
-		ApplyGameplayEffectSpecToTarget(*SpecHandle.Data, TargetABSC);
+		ApplyGameplayEffectSpecToTarget(Spec, TargetABSC);
 	}
 }
 
-void UPEAbilitySystemComponent::RemoveEffectGroupedDataFromSelf(const FGameplayEffectGroupedData GroupedData, UAbilitySystemComponent* InstigatorABSC, const int32 StacksToRemove)
+void UPEAbilitySystemComponent::ApplyEffectGroupedDataToTargets(const TArrayView<const FGameplayEffectGroupedData> GroupedData, const TArrayView<UAbilitySystemComponent* const> TargetABSCs, UPEAbilitySystemComponent* InstigatorABSC)
 {
-	if (!IsOwnerActorAuthoritative())
+	PE_GAS_PROFILE_SCOPE(ApplyEffectGroupedData, GroupedData.Num() == 1 ? GroupedData[0].EffectClass.Get() : nullptr);
+
+	if (TargetABSCs.IsEmpty() || GroupedData.IsEmpty())
 	{
 		return;
 	}
-	
-	if (!IsValid(GroupedData.EffectClass))
+
+	// Overlap queries may return the same target more than once: Keep each target only once
+	TSet<UAbilitySystemComponent*, DefaultKeyFuncs<UAbilitySystemComponent*>, TInlineSetAllocator<32>> UniqueTargets;
+	UniqueTargets.Reserve(TargetABSCs.Num());
+
+	for (UAbilitySystemComponent* const TargetABSC : TargetABSCs)
 	{
-		return;
+		if (IsValid(TargetABSC))
+		{
+			UniqueTargets.Add(TargetABSC);
+		}
 	}
-	
-	FGameplayEffectQuery Query;
-	Query.CustomMatchDelegate.BindLambda([&](const FActiveGameplayEffect& CurEffect)
+
+	if (IsValid(InstigatorABSC))
 	{
-		bool bMatches = false;
+		if (!InstigatorABSC->IsOwnerActorAuthoritative())
+		{
+			return;
+		}
 
-		if (IsValid(CurEffect.Spec.Def) && GroupedData.EffectClass == CurEffect.Spec.Def->GetClass() && InstigatorABSC == CurEffect.Spec.GetEffectContext().GetInstigatorAbilitySystemComponent())
+		for (const FGameplayEffectGroupedData& Effect : GroupedData)
 		{
-			for (const TPair<FGameplayTag, float>& Iterator : GroupedData.SetByCallerStackedData)
+			if (const FGameplayEffectSpec* const SpecTemplate = InstigatorABSC->FindOrAddEffectSpecTemplate(Effect))
 			{
-				bMatches = CurEffect.Spec.SetByCallerTagMagnitudes.FindRef(Iterator.Key) == Iterator.Value;
+				// Build the spec once and fan out to all targets
+				FGameplayEffectSpec Spec(*SpecTemplate);
+				Spec.SetContext(InstigatorABSC->MakeEffectContext());
+				Spec.CaptureDataFromSource(true);
 
-				if (!bMatches)
+				for (UAbilitySystemComponent* const TargetABSC : UniqueTargets)
 				{
-					break;
+					InstigatorABSC->ApplyGameplayEffectSpecToTarget(Spec, TargetABSC);
 				}
 			}
 		}
 
-		return bMatches;
-	});
+		return;
+	}
+
+	for (UAbilitySystemComponent* const TargetABSC : UniqueTargets)
+	{
+		if (UPEAbilitySystemComponent* const TargetGASC = Cast<UPEAbilitySystemComponent>(TargetABSC))
+		{
+			for (const FGameplayEffectGroupedData& Effect : GroupedData)
+			{
+				TargetGASC->ApplyEffectGroupedDataToSelf(Effect);
+			}
+		}
+	}
+}
+
+const FGameplayEffectSpec* UPEAbilitySystemComponent::FindOrAddEffectSpecTemplate(const FGameplayEffectGroupedData& GroupedData)
+{
+	if (!IsValid(GroupedData.EffectClass))
+	{
+		return nullptr;
+	}
+
+	FPEEffectSpecTemplateKey TemplateKey(GroupedData.EffectClass.Get(), 1.f, GroupedData.GetSetByCallerData());
+
+	if (const FGameplayEffectSpec* const SpecTemplate = EffectSpecTemplates.Find(TemplateKey))
+	{
+		INC_DWORD_STAT(STAT_PEEffectSpecTemplateHits);
+		return SpecTemplate;
+	}
+
+	INC_DWORD_STAT(STAT_PEEffectSpecTemplateMisses);
+
+	const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingSpec(GroupedData.EffectClass, TemplateKey.Level, MakeEffectContext());
+	if (!SpecHandle.IsValid())
+	{
+		return nullptr;
+	}
+
+	for (const TPair<FGameplayTag, float>& StackedData : TemplateKey.SetByCallerData)
+	{
+		SpecHandle.Data.Get()->SetSetByCallerMagnitude(StackedData.Key, StackedData.Value);
+	}
+
+	// Runtime generated Set by Caller values would grow the cache without bound: start over when it is full
+	if (EffectSpecTemplates.Num() >= MaxEffectSpecTemplates)
+	{
+		EffectSpecTemplates.Reset();
+	}
+
+	return &EffectSpecTemplates.Add(MoveTemp(TemplateKey), *SpecHandle.Data.Get());
+}
+
+void UPEAbilitySystemComponent::RemoveEffectGroupedDataFromSelf(const FGameplayEffectGroupedData& GroupedData, UAbilitySystemComponent* InstigatorABSC, const int32 StacksToRemove)
+{
+	PE_GAS_PROFILE_SCOPE(RemoveEffectGroupedData, GroupedData.EffectClass.Get());
+
+	if (!IsOwnerActorAuthoritative())
+	{
+		return;
+	}
+	
+	if (!IsValid(GroupedData.EffectClass))
+	{
+		return;
+	}
 
 	bIsNetDirty = true;
-	RemoveActiveEffects(Query, StacksToRemove);
+	RemoveIndexedEffectGroupedData(GroupedData, InstigatorABSC, StacksToRemove);
 }
 
-void UPEAbilitySystemComponent::RemoveEffectGroupedDataFromTarget(const FGameplayEffectGroupedData GroupedData, UAbilitySystemComponent* InstigatorABSC, UAbilitySystemComponent* TargetABSC, const int32 StacksToRemove)
+void UPEAbilitySystemComponent::RemoveEffectGroupedDataFromTarget(const FGameplayEffectGroupedData& GroupedData, UAbilitySystemComponent* InstigatorABSC, UAbilitySystemComponent* TargetABSC, const int32 StacksToRemove)
 {
+	PE_GAS_PROFILE_SCOPE(RemoveEffectGroupedData, GroupedData.EffectClass.Get());
+
 	if (!IsOwnerActorAuthoritative())
 	{
 		return;
@@ -111,94 +224,235 @@ void UPEAbilitySystemComponent::RemoveEffectGroupedDataFromTarget(const FGamepla
 		return;
 	}
 
+	bIsNetDirty = true;
+
+	if (UPEAbilitySystemComponent* const TargetGASC = Cast<UPEAbilitySystemComponent>(TargetABSC))
+	{
+		TargetGASC->RemoveIndexedEffectGroupedData(GroupedData, InstigatorABSC, StacksToRemove);
+		return;
+	}
+
+	// Targets without the active effect index will need to check all active effects
 	FGameplayEffectQuery Query;
 	Query.CustomMatchDelegate.BindLambda([&](const FActiveGameplayEffect& CurEffect)
 	{
-		bool bMatches = false;
+		return DoesActiveEffectMatchGroupedData(CurEffect, GroupedData, InstigatorABSC);
+	});
 
-		if (IsValid(CurEffect.Spec.Def) && GroupedData.EffectClass == CurEffect.Spec.Def->GetClass() && InstigatorABSC == CurEffect.Spec.GetEffectContext().GetInstigatorAbilitySystemComponent())
-		{
-			for (const TPair<FGameplayTag, float>& Iterator : GroupedData.SetByCallerStackedData)
-			{
-				bMatches = CurEffect.Spec.SetByCallerTagMagnitudes.FindRef(Iterator.Key) == Iterator.Value;
+	TargetABSC->RemoveActiveEffects(Query, StacksToRemove);
+}
 
-				if (!bMatches)
-				{
-					break;
-				}
-			}
+void UPEAbilitySystemComponent::RemoveIndexedEffectGroupedData(const FGameplayEffectGroupedData& GroupedData, const UAbilitySystemComponent* InstigatorABSC, const int32 StacksToRemove)
+{
+	const FPEActiveEffectIndexKey IndexKey(GroupedData.EffectClass.Get(), InstigatorABSC);
+
+	// Copy the handles: the index is updated while the effects are removed
+	TArray<FActiveGameplayEffectHandle, TInlineAllocator<8>> IndexedHandles;
+	ActiveEffectIndex.MultiFind(IndexKey, IndexedHandles);
+
+	for (const FActiveGameplayEffectHandle& Handle : IndexedHandles)
+	{
+		if (const FActiveGameplayEffect* const ActiveEffect = GetActiveGameplayEffect(Handle);
+			ActiveEffect && DoesActiveEffectMatchGroupedData(*ActiveEffect, GroupedData, InstigatorABSC))
+		{
+			RemoveActiveGameplayEffect(Handle, StacksToRemove);
 		}
+	}
+}
 
-		return bMatches;
-	});
+void UPEAbilitySystemComponent::IndexActiveEffect(const FGameplayEffectSpec& Spec, const FActiveGameplayEffectHandle Handle)
+{
+	if (!IsValid(Spec.Def) || ActiveEffectIndexKeys.Contains(Handle))
+	{
+		return;
+	}
 
-	bIsNetDirty = true;
-	TargetABSC->RemoveActiveEffects(Query, StacksToRemove);
+	const FPEActiveEffectIndexKey IndexKey(Spec.Def->GetClass(), Spec.GetEffectContext().GetInstigatorAbilitySystemComponent());
+
+	ActiveEffectIndex.Add(IndexKey, Handle);
+	ActiveEffectIndexKeys.Add(Handle, IndexKey);
+}
+
+void UPEAbilitySystemComponent::OnActiveEffectAdded_Callback([[maybe_unused]] UAbilitySystemComponent* SourceABSC, const FGameplayEffectSpec& Spec, const FActiveGameplayEffectHandle Handle)
+{
+	if (IsOwnerActorAuthoritative())
+	{
+		IndexActiveEffect(Spec, Handle);
+	}
+}
+
+void UPEAbilitySystemComponent::OnActiveEffectRemoved_Callback(const FActiveGameplayEffect& Effect)
+{
+	if (FPEActiveEffectIndexKey IndexKey; ActiveEffectIndexKeys.RemoveAndCopyValue(Effect.Handle, IndexKey))
+	{
+		ActiveEffectIndex.RemoveSingle(IndexKey, Effect.Handle);
+	}
 }
 
 void UPEAbilitySystemComponent::InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor)
 {
 	Super::InitAbilityActorInfo(InOwnerActor, InAvatarActor);
+
+	// Keep the active effect index updated: this function can be called multiple times
+	OnActiveGameplayEffectAddedDelegateToSelf.RemoveAll(this);
+	OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &UPEAbilitySystemComponent::OnActiveEffectAdded_Callback);
+
+	OnAnyGameplayEffectRemovedDelegate().RemoveAll(this);
+	OnAnyGameplayEffectRemovedDelegate().AddUObject(this, &UPEAbilitySystemComponent::OnActiveEffectRemoved_Callback);
+
+	// Effects applied before the callbacks were bound are indexed now
+	if (IsOwnerActorAuthoritative())
+	{
+		for (const FActiveGameplayEffect& ActiveEffect : &ActiveGameplayEffects)
+		{
+			IndexActiveEffect(ActiveEffect.Spec, ActiveEffect.Handle);
+		}
+	}
 }
 
-void UPEAbilitySystemComponent::InitializeAttributeViewModel(const UAttributeSet* AttributeSet)
+void UPEAbilitySystemComponent::RegisterInterruptibleAbility(UPEGameplayAbility* Ability)
 {
-	UE_LOG(LogTemp, Display, TEXT("%s - Initializing view model for attribute %s"), *FString(__func__), *AttributeSet->GetName());
-
-	if (AttributeSet->GetClass()->IsChildOf<UPEBasicStatusAS>())
+	if (!IsValid(Ability))
 	{
-		InitializeBasicAttributesViewModel(Cast<UPEBasicStatusAS>(AttributeSet));
 		return;
 	}
 
-	if (AttributeSet->GetClass()->IsChildOf<UPECustomStatusAS>())
+	const FGameplayTagContainer& InterruptTags = Ability->GetActivationProfile().InterruptTags;
+
+	// Each tag event is bound only once and shared by all registered abilities
+	for (const FGameplayTag& InterruptTag : InterruptTags)
 	{
-		InitializeCustomAttributesViewModel(Cast<UPECustomStatusAS>(AttributeSet));
-		return;
+		if (!RegisteredInterruptTags.HasTagExact(InterruptTag))
+		{
+			RegisteredInterruptTags.AddTag(InterruptTag);
+			RegisterGameplayTagEvent(InterruptTag, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &UPEAbilitySystemComponent::OnInterruptTagChanged_Callback);
+		}
+	}
+
+	InterruptibleAbilities.AddUnique(Ability);
+
+	// The interrupt tag may already be present
+	if (HasAnyMatchingGameplayTags(InterruptTags))
+	{
+		Ability->InterruptAbility();
 	}
+}
 
-	if (AttributeSet->GetClass()->IsChildOf<UPELevelingAS>())
+void UPEAbilitySystemComponent::UnregisterInterruptibleAbility(UPEGameplayAbility* Ability)
+{
+	InterruptibleAbilities.RemoveSingleSwap(Ability, false);
+}
+
+void UPEAbilitySystemComponent::OnInterruptTagChanged_Callback(const FGameplayTag InterruptTag, const int32 NewCount)
+{
+	if (NewCount <= 0 || InterruptibleAbilities.IsEmpty())
 	{
-		InitializeLevelingAttributesViewModel(Cast<UPELevelingAS>(AttributeSet));
 		return;
 	}
+
+	// Ending an ability will unregister it: iterate over a copy
+	const TArray<TWeakObjectPtr<UPEGameplayAbility>, TInlineAllocator<16>> AbilitiesToInterrupt(InterruptibleAbilities);
+
+	for (const TWeakObjectPtr<UPEGameplayAbility>& Ability : AbilitiesToInterrupt)
+	{
+		if (Ability.IsValid() && Ability->GetActivationProfile().InterruptTags.HasTagExact(InterruptTag))
+		{
+			Ability->InterruptAbility();
+		}
+	}
+
+	InterruptibleAbilities.RemoveAllSwap([](const TWeakObjectPtr<UPEGameplayAbility>& Ability)
+	{
+		return !Ability.IsValid();
+	});
 }
 
-#define REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(AttributeClass, AttributeName, ViewModelClass, ViewModelObject) \
-if (GetGameplayAttributeValueChangeDelegate(##AttributeClass##::Get##AttributeName##Attribute()).IsBoundToObject(ViewModelObject)) \
-{ \
-	GetGameplayAttributeValueChangeDelegate(##AttributeClass##::Get##AttributeName##Attribute()).RemoveAll(ViewModelObject); \
-} \
-GetGameplayAttributeValueChangeDelegate(##AttributeClass##::Get##AttributeName##Attribute()).AddUObject(ViewModelObject, &##ViewModelClass##::OnAttributeChange); \
-/* This block is used to initialize the first value of the attribute because the viewmodel is only updating when the attribute changes after the binding occurs */ \
-{ \
-	const float AttributeValue = Attribute->Get##AttributeName##(); \
-	ViewModelClass##::Set##AttributeName##_WrapperImpl(ViewModelObject, static_cast<const void*>(&AttributeValue)); \
+AGameplayAbilityTargetActor* UPEAbilitySystemComponent::AcquirePooledTargetActor(const UClass* TargetActorClass)
+{
+	for (int32 Index = PooledTargetActors.Num() - 1; Index >= 0; --Index)
+	{
+		AGameplayAbilityTargetActor* const PooledActor = PooledTargetActors[Index];
+
+		// Parked actors may be destroyed by the world (e.g. level transitions)
+		if (!IsValid(PooledActor))
+		{
+			PooledTargetActors.RemoveAtSwap(Index, 1, false);
+			continue;
+		}
+
+		if (PooledActor->GetClass() == TargetActorClass)
+		{
+			PooledTargetActors.RemoveAtSwap(Index, 1, false);
+			CastChecked<IPEPooledTargetActor>(PooledActor)->OnAcquiredFromPool();
+
+			return PooledActor;
+		}
+	}
+
+	return nullptr;
 }
 
-void UPEAbilitySystemComponent::InitializeBasicAttributesViewModel(const UPEBasicStatusAS* Attribute)
+bool UPEAbilitySystemComponent::ReleasePooledTargetActor(AGameplayAbilityTargetActor* TargetActor)
 {
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPEBasicStatusAS, Health, UPEVM_AttributeBasic, BasicAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPEBasicStatusAS, MaxHealth, UPEVM_AttributeBasic, BasicAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPEBasicStatusAS, Stamina, UPEVM_AttributeBasic, BasicAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPEBasicStatusAS, MaxStamina, UPEVM_AttributeBasic, BasicAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPEBasicStatusAS, Mana, UPEVM_AttributeBasic, BasicAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPEBasicStatusAS, MaxMana, UPEVM_AttributeBasic, BasicAttributes_VM);
+	IPEPooledTargetActor* const PooledInterface = Cast<IPEPooledTargetActor>(TargetActor);
+	if (!PooledInterface || !IsValid(TargetActor) || PooledTargetActors.Num() >= MaxPooledTargetActors || PooledTargetActors.Contains(TargetActor))
+	{
+		return false;
+	}
+
+	// Parked actors must not receive the confirm/cancel inputs: Cancelling a targeting actor destroys it
+	SpawnedTargetActors.Remove(TargetActor);
+	GenericLocalConfirmCallbacks.RemoveAll(TargetActor);
+	GenericLocalCancelCallbacks.RemoveAll(TargetActor);
+
+	TargetActor->TargetDataReadyDelegate.Clear();
+	TargetActor->CanceledDelegate.Clear();
+
+	PooledInterface->OnReleasedToPool();
+	PooledTargetActors.Add(TargetActor);
+
+	return true;
 }
 
-void UPEAbilitySystemComponent::InitializeCustomAttributesViewModel(const UPECustomStatusAS* Attribute)
+void UPEAbilitySystemComponent::OnComponentDestroyed(const bool bDestroyingHierarchy)
 {
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPECustomStatusAS, AttackRate, UPEVM_AttributeCustom, CustomAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPECustomStatusAS, DefenseRate, UPEVM_AttributeCustom, CustomAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPECustomStatusAS, SpeedRate, UPEVM_AttributeCustom, CustomAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPECustomStatusAS, JumpRate, UPEVM_AttributeCustom, CustomAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPECustomStatusAS, Gold, UPEVM_AttributeCustom, CustomAttributes_VM);
+	// Parked actors are owned by this component
+	for (AGameplayAbilityTargetActor* const PooledActor : PooledTargetActors)
+	{
+		if (IsValid(PooledActor))
+		{
+			PooledActor->Destroy();
+		}
+	}
+
+	PooledTargetActors.Empty();
+
+	Super::OnComponentDestroyed(bDestroyingHierarchy);
 }
 
-void UPEAbilitySystemComponent::InitializeLevelingAttributesViewModel(const UPELevelingAS* Attribute)
+void UPEAbilitySystemComponent::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
 {
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPELevelingAS, CurrentLevel, UPEVM_AttributeLeveling, LevelingAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPELevelingAS, CurrentExperience, UPEVM_AttributeLeveling, LevelingAttributes_VM);
-	REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL(UPELevelingAS, RequiredExperience, UPEVM_AttributeLeveling, LevelingAttributes_VM);
+	Super::AddReferencedObjects(InThis, Collector);
+
+	// The cached templates aren't reflected: keep their effect definitions alive
+	for (TPair<FPEEffectSpecTemplateKey, FGameplayEffectSpec>& SpecTemplate : CastChecked<UPEAbilitySystemComponent>(InThis)->EffectSpecTemplates)
+	{
+		Collector.AddReferencedObject(SpecTemplate.Value.Def);
+	}
 }
-#undef REGISTER_ATTRIBUTE_DELEGATE_TO_VIEWMODEL
\ No newline at end of file
+
+void UPEAbilitySystemComponent::InitializeAttributeViewModel(const UAttributeSet* AttributeSet)
+{
+	UE_LOG(LogTemp, Display, TEXT("%s - Initializing view model for attribute %s"), *FString(__func__), *AttributeSet->GetName());
+
+	// Each view model binds the attributes that matches its properties, so any attribute set can be used without extra registration
+	const TArray<UPEVM_AttributeBase*, TInlineAllocator<3>> ViewModels { BasicAttributes_VM, CustomAttributes_VM, LevelingAttributes_VM };
+
+	for (UPEVM_AttributeBase* const ViewModel : ViewModels)
+	{
+		if (IsValid(ViewModel))
+		{
+			ViewModel->BindAttributeSet(this, AttributeSet);
+		}
+	}
+}
\ No newline at end of file
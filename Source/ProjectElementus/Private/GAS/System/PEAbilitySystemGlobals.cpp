@@ -0,0 +1,11 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/System/PEAbilitySystemGlobals.h"
+#include "GAS/System/PEEffectContext.h"
+
+FGameplayEffectContext* UPEAbilitySystemGlobals::AllocGameplayEffectContext() const
+{
+	return new FPEGameplayEffectContext();
+}
@@ -0,0 +1,57 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/System/PEEffectContext.h"
+
+FPEGameplayEffectContext::FPEGameplayEffectContext() : Super(), RandomSeed(FMath::Rand())
+{
+}
+
+FPEGameplayEffectContext::FPEGameplayEffectContext(AActor* InInstigator, AActor* InEffectCauser) : Super(InInstigator, InEffectCauser), RandomSeed(FMath::Rand())
+{
+}
+
+int32 FPEGameplayEffectContext::GetRandomSeed() const
+{
+	return RandomSeed;
+}
+
+UScriptStruct* FPEGameplayEffectContext::GetScriptStruct() const
+{
+	return StaticStruct();
+}
+
+FGameplayEffectContext* FPEGameplayEffectContext::Duplicate() const
+{
+	FPEGameplayEffectContext* const NewContext = new FPEGameplayEffectContext();
+	*NewContext = *this;
+
+	if (GetHitResult())
+	{
+		// Does a deep copy of the hit result
+		NewContext->AddHitResult(*GetHitResult(), true);
+	}
+
+	return NewContext;
+}
+
+bool FPEGameplayEffectContext::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	const bool bSuperSuccess = Super::NetSerialize(Ar, Map, bOutSuccess);
+
+	Ar << RandomSeed;
+
+	bOutSuccess &= bSuperSuccess;
+	return bSuperSuccess;
+}
+
+int32 FPEGameplayEffectContext::GetRandomSeed(const FGameplayEffectContextHandle& InContext)
+{
+	if (const FGameplayEffectContext* const Context = InContext.Get(); Context && Context->GetScriptStruct()->IsChildOf(StaticStruct()))
+	{
+		return static_cast<const FPEGameplayEffectContext*>(Context)->GetRandomSeed();
+	}
+
+	return 0;
+}
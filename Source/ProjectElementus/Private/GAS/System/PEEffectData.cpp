@@ -2,4 +2,154 @@
 // Year: 2022
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
-#include "GAS/System/PEEffectData.h"
\ No newline at end of file
+#include "GAS/System/PEEffectData.h"
+
+static uint32 GetSetByCallerEntryHash(const FGameplayTag& Tag, const float Value)
+{
+	return HashCombine(GetTypeHash(Tag), GetTypeHash(Value));
+}
+
+FGameplayEffectGroupedData::FGameplayEffectGroupedData(const FGameplayEffectGroupedData& Other) : EffectClass(Other.EffectClass), SetByCallerStackedData(Other.SetByCallerStackedData)
+{
+}
+
+FGameplayEffectGroupedData& FGameplayEffectGroupedData::operator=(const FGameplayEffectGroupedData& Other)
+{
+	EffectClass = Other.EffectClass;
+	SetByCallerStackedData = Other.SetByCallerStackedData;
+
+	InvalidateSetByCallerData();
+
+	return *this;
+}
+
+FGameplayEffectGroupedData::FGameplayEffectGroupedData(FGameplayEffectGroupedData&& Other) noexcept : EffectClass(MoveTemp(Other.EffectClass)), SetByCallerStackedData(MoveTemp(Other.SetByCallerStackedData)), SetByCallerData(MoveTemp(Other.SetByCallerData)), SetByCallerSignature(Other.SetByCallerSignature), bSetByCallerDataUpdated(Other.bSetByCallerDataUpdated)
+{
+	Other.InvalidateSetByCallerData();
+}
+
+FGameplayEffectGroupedData& FGameplayEffectGroupedData::operator=(FGameplayEffectGroupedData&& Other) noexcept
+{
+	EffectClass = MoveTemp(Other.EffectClass);
+	SetByCallerStackedData = MoveTemp(Other.SetByCallerStackedData);
+	SetByCallerData = MoveTemp(Other.SetByCallerData);
+	SetByCallerSignature = Other.SetByCallerSignature;
+	bSetByCallerDataUpdated = Other.bSetByCallerDataUpdated;
+
+	Other.InvalidateSetByCallerData();
+
+	return *this;
+}
+
+void FGameplayEffectGroupedData::SetSetByCallerMagnitude(const FGameplayTag& InTag, const float InValue)
+{
+	SetByCallerStackedData.Add(InTag, InValue);
+	InvalidateSetByCallerData();
+}
+
+void FGameplayEffectGroupedData::RemoveSetByCallerMagnitude(const FGameplayTag& InTag)
+{
+	SetByCallerStackedData.Remove(InTag);
+	InvalidateSetByCallerData();
+}
+
+void FGameplayEffectGroupedData::InvalidateSetByCallerData() const
+{
+	bSetByCallerDataUpdated = false;
+}
+
+const FPESetByCallerData& FGameplayEffectGroupedData::GetSetByCallerData() const
+{
+	// Details panel edits don't go through the mutators: Rebuild only if the map no longer matches the cached data
+#if WITH_EDITOR
+	if (bSetByCallerDataUpdated && MakeSetByCallerSignature(SetByCallerStackedData) != SetByCallerSignature)
+	{
+		bSetByCallerDataUpdated = false;
+	}
+#endif WITH_EDITOR
+
+	if (!bSetByCallerDataUpdated)
+	{
+		UpdateSetByCallerData();
+	}
+
+	return SetByCallerData;
+}
+
+uint32 FGameplayEffectGroupedData::GetSetByCallerSignature() const
+{
+	GetSetByCallerData();
+	return SetByCallerSignature;
+}
+
+uint32 FGameplayEffectGroupedData::MakeSetByCallerSignature(const TMap<FGameplayTag, float>& SetByCallerData)
+{
+	uint32 Signature = 0u;
+	for (const TPair<FGameplayTag, float>& StackedData : SetByCallerData)
+	{
+		if (StackedData.Key.IsValid())
+		{
+			Signature += GetSetByCallerEntryHash(StackedData.Key, StackedData.Value);
+		}
+	}
+
+	return Signature;
+}
+
+void FGameplayEffectGroupedData::PostSerialize(const FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		UpdateSetByCallerData();
+	}
+}
+
+bool FGameplayEffectGroupedData::operator==(const FGameplayEffectGroupedData& Other) const
+{
+	if (EffectClass != Other.EffectClass)
+	{
+		return false;
+	}
+
+	const FPESetByCallerData& Data = GetSetByCallerData();
+	const FPESetByCallerData& OtherData = Other.GetSetByCallerData();
+
+	// Both signatures are up to date after GetSetByCallerData
+	if (SetByCallerSignature != Other.SetByCallerSignature || Data.Num() != OtherData.Num())
+	{
+		return false;
+	}
+
+	// Both arrays are sorted: compare element by element
+	for (int32 Index = 0; Index < Data.Num(); ++Index)
+	{
+		if (Data[Index].Key != OtherData[Index].Key || Data[Index].Value != OtherData[Index].Value)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FGameplayEffectGroupedData::UpdateSetByCallerData() const
+{
+	SetByCallerData.Reset();
+	SetByCallerSignature = 0u;
+
+	for (const TPair<FGameplayTag, float>& StackedData : SetByCallerStackedData)
+	{
+		if (StackedData.Key.IsValid())
+		{
+			SetByCallerData.Add(StackedData);
+			SetByCallerSignature += GetSetByCallerEntryHash(StackedData.Key, StackedData.Value);
+		}
+	}
+
+	SetByCallerData.Sort([](const TPair<FGameplayTag, float>& Lhs, const TPair<FGameplayTag, float>& Rhs)
+	{
+		return Lhs.Key.GetTagName().FastLess(Rhs.Key.GetTagName());
+	});
+
+	bSetByCallerDataUpdated = true;
+}
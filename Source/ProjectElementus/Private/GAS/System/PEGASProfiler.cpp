@@ -0,0 +1,216 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/System/PEGASProfiler.h"
+#include <HAL/IConsoleManager.h>
+#include <ProfilingDebugging/CsvProfiler.h>
+#include <UObject/ObjectKey.h>
+
+CSV_DEFINE_CATEGORY(ProjectElementus, true);
+
+DEFINE_STAT(STAT_PEGAS_PreActivate);
+DEFINE_STAT(STAT_PEGAS_ActivateAbility);
+DEFINE_STAT(STAT_PEGAS_EndAbility);
+DEFINE_STAT(STAT_PEGAS_CheckCost);
+DEFINE_STAT(STAT_PEGAS_ApplyCost);
+DEFINE_STAT(STAT_PEGAS_CheckCooldown);
+DEFINE_STAT(STAT_PEGAS_ApplyCooldown);
+DEFINE_STAT(STAT_PEGAS_ApplyEffectSpec);
+DEFINE_STAT(STAT_PEGAS_ApplyEffectGroupedData);
+DEFINE_STAT(STAT_PEGAS_RemoveEffectGroupedData);
+DEFINE_STAT(STAT_PEGAS_PreAttributeChange);
+DEFINE_STAT(STAT_PEGAS_PostAttributeChange);
+DEFINE_STAT(STAT_PEGAS_PostGameplayEffectExecute);
+
+static int32 GPEGASProfiling = 1;
+static FAutoConsoleVariableRef CVarPEGASProfiling(
+	TEXT("PE.GAS.Profiling"),
+	GPEGASProfiling,
+	TEXT("Enable the per class timings of the GAS entry points. 0: Disabled, 1: Enabled"));
+
+namespace GASProfiler
+{
+	struct FProfileKey
+	{
+		EPEGASProfileScope Scope;
+		TObjectKey<UClass> ContextClass;
+
+		bool operator==(const FProfileKey& Other) const
+		{
+			return Scope == Other.Scope && ContextClass == Other.ContextClass;
+		}
+
+		friend uint32 GetTypeHash(const FProfileKey& Key)
+		{
+			return HashCombine(static_cast<uint32>(Key.Scope), GetTypeHash(Key.ContextClass));
+		}
+	};
+
+	struct FProfileEntry
+	{
+		FString ContextName;
+		FName CsvStatName;
+		uint64 Calls = 0u;
+		uint64 TotalCycles = 0u;
+		uint64 MaxCycles = 0u;
+	};
+
+	TMap<FProfileKey, FProfileEntry>& GetEntries()
+	{
+		static TMap<FProfileKey, FProfileEntry> Entries;
+		return Entries;
+	}
+}
+
+uint32 FPEGASProfiler::ActiveScopes = 0u;
+
+bool FPEGASProfiler::IsEnabled()
+{
+	return GPEGASProfiling != 0;
+}
+
+bool FPEGASProfiler::BeginScope(const EPEGASProfileScope InScope)
+{
+	// GAS runs on the game thread: Measures from other threads are discarded instead of locking
+	if (!IsEnabled() || !IsInGameThread())
+	{
+		return false;
+	}
+
+	const uint32 ScopeBit = 1u << static_cast<uint8>(InScope);
+	if (ActiveScopes & ScopeBit)
+	{
+		return false;
+	}
+
+	ActiveScopes |= ScopeBit;
+	return true;
+}
+
+void FPEGASProfiler::EndScope(const EPEGASProfileScope InScope, const UClass* InContextClass, const uint64 InCycles)
+{
+	ActiveScopes &= ~(1u << static_cast<uint8>(InScope));
+
+	GASProfiler::FProfileEntry& Entry = GASProfiler::GetEntries().FindOrAdd(GASProfiler::FProfileKey{ InScope, InContextClass });
+
+	if (Entry.Calls == 0u)
+	{
+		Entry.ContextName = GetNameSafe(InContextClass);
+		Entry.CsvStatName = *FString::Printf(TEXT("%s/%s"), GetScopeName(InScope), *Entry.ContextName);
+	}
+
+	++Entry.Calls;
+	Entry.TotalCycles += InCycles;
+	Entry.MaxCycles = FMath::Max(Entry.MaxCycles, InCycles);
+
+#if CSV_PROFILER
+	// Custom stats instead of scoped timing stats: Nested measures of the same scope are already discarded by BeginScope
+	static const TArray<FName> ScopeCsvStatNames = []
+	{
+		TArray<FName> Names;
+		for (uint8 Iterator = 0; Iterator < static_cast<uint8>(EPEGASProfileScope::MAX); ++Iterator)
+		{
+			Names.Add(GetScopeName(static_cast<EPEGASProfileScope>(Iterator)));
+		}
+
+		return Names;
+	}();
+
+	FCsvProfiler::RecordCustomStat(ScopeCsvStatNames[static_cast<uint8>(InScope)], CSV_CATEGORY_INDEX(ProjectElementus), static_cast<float>(FPlatformTime::ToMilliseconds64(InCycles)), ECsvCustomStatOp::Accumulate);
+	FCsvProfiler::RecordCustomStat(Entry.CsvStatName, CSV_CATEGORY_INDEX(ProjectElementus), static_cast<float>(FPlatformTime::ToMilliseconds64(InCycles)), ECsvCustomStatOp::Accumulate);
+#endif
+}
+
+void FPEGASProfiler::Dump(FOutputDevice& Ar)
+{
+	TArray<const GASProfiler::FProfileKey*> SortedKeys;
+	for (const TPair<GASProfiler::FProfileKey, GASProfiler::FProfileEntry>& Iterator : GASProfiler::GetEntries())
+	{
+		SortedKeys.Add(&Iterator.Key);
+	}
+
+	const TMap<GASProfiler::FProfileKey, GASProfiler::FProfileEntry>& Entries = GASProfiler::GetEntries();
+
+	// Most expensive entries first
+	SortedKeys.Sort([&Entries](const GASProfiler::FProfileKey& A, const GASProfiler::FProfileKey& B)
+	{
+		return Entries.FindChecked(A).TotalCycles > Entries.FindChecked(B).TotalCycles;
+	});
+
+	Ar.Logf(TEXT("%-26s %-48s %10s %12s %12s %12s"), TEXT("Scope"), TEXT("Class"), TEXT("Calls"), TEXT("Total (ms)"), TEXT("Avg (us)"), TEXT("Max (us)"));
+
+	for (const GASProfiler::FProfileKey* const Key : SortedKeys)
+	{
+		const GASProfiler::FProfileEntry& Entry = Entries.FindChecked(*Key);
+
+		const double TotalMs = FPlatformTime::ToMilliseconds64(Entry.TotalCycles);
+		const double AverageUs = TotalMs * 1000.0 / static_cast<double>(Entry.Calls);
+		const double MaxUs = FPlatformTime::ToMilliseconds64(Entry.MaxCycles) * 1000.0;
+
+		Ar.Logf(TEXT("%-26s %-48s %10llu %12.3f %12.3f %12.3f"), GetScopeName(Key->Scope), *Entry.ContextName, Entry.Calls, TotalMs, AverageUs, MaxUs);
+	}
+}
+
+void FPEGASProfiler::Reset()
+{
+	GASProfiler::GetEntries().Reset();
+}
+
+const TCHAR* FPEGASProfiler::GetScopeName(const EPEGASProfileScope InScope)
+{
+	switch (InScope)
+	{
+		case EPEGASProfileScope::PreActivate:
+			return TEXT("PreActivate");
+
+		case EPEGASProfileScope::ActivateAbility:
+			return TEXT("ActivateAbility");
+
+		case EPEGASProfileScope::EndAbility:
+			return TEXT("EndAbility");
+
+		case EPEGASProfileScope::CheckCost:
+			return TEXT("CheckCost");
+
+		case EPEGASProfileScope::ApplyCost:
+			return TEXT("ApplyCost");
+
+		case EPEGASProfileScope::CheckCooldown:
+			return TEXT("CheckCooldown");
+
+		case EPEGASProfileScope::ApplyCooldown:
+			return TEXT("ApplyCooldown");
+
+		case EPEGASProfileScope::ApplyEffectSpec:
+			return TEXT("ApplyEffectSpec");
+
+		case EPEGASProfileScope::ApplyEffectGroupedData:
+			return TEXT("ApplyEffectGroupedData");
+
+		case EPEGASProfileScope::RemoveEffectGroupedData:
+			return TEXT("RemoveEffectGroupedData");
+
+		case EPEGASProfileScope::PreAttributeChange:
+			return TEXT("PreAttributeChange");
+
+		case EPEGASProfileScope::PostAttributeChange:
+			return TEXT("PostAttributeChange");
+
+		case EPEGASProfileScope::PostGameplayEffectExecute:
+			return TEXT("PostGameplayEffectExecute");
+
+		default:
+			return TEXT("Unknown");
+	}
+}
+
+static FAutoConsoleCommandWithOutputDevice PEGASDumpProfileCommand(
+	TEXT("PE.GAS.DumpProfile"),
+	TEXT("Print the per class timings of the GAS entry points, sorted by total time"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FPEGASProfiler::Dump));
+
+static FAutoConsoleCommand PEGASResetProfileCommand(
+	TEXT("PE.GAS.ResetProfile"),
+	TEXT("Clear the per class timings of the GAS entry points"),
+	FConsoleCommandDelegate::CreateStatic(&FPEGASProfiler::Reset));
@@ -4,14 +4,18 @@
 
 #include "GAS/System/PEGameplayAbility.h"
 #include "GAS/System/PEAbilitySystemComponent.h"
+#include "GAS/System/PEGASProfiler.h"
 #include "GAS/System/PEAbilityData.h"
+#include "GAS/System/PEAbilityFunctions.h"
 #include "GAS/System/PETrace.h"
 #include "GAS/Effects/PECooldownEffect.h"
 #include "GAS/Effects/PECostEffect.h"
 #include "GAS/Tasks/PESpawnProjectile_Task.h"
+#include "GAS/Tasks/PEWaitTargetData_Task.h"
 #include "Actors/Character/PECharacter.h"
 #include "Actors/World/PEProjectileActor.h"
 #include "Management/Data/PEGlobalTags.h"
+#include "Management/Subsystems/PERegenerationSubsystem.h"
 #include <Abilities/Tasks/AbilityTask_WaitGameplayEvent.h>
 #include <Abilities/Tasks/AbilityTask_PlayMontageAndWait.h>
 #include <Abilities/Tasks/AbilityTask_WaitConfirmCancel.h>
@@ -26,25 +30,129 @@
 #include <Kismet/GameplayStatics.h>
 #include <AbilitySystemLog.h>
 
-UPEGameplayAbility::UPEGameplayAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), AbilityMaxRange(0), bIgnoreCost(false), bIgnoreCooldown(false), bWaitCancel(true), AbilityActiveTime(0), bEndAbilityAfterActiveTime(false)
+UPEGameplayAbility::UPEGameplayAbility(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), AbilityMaxRange(0), bIgnoreCost(false), bIgnoreCooldown(false), bWaitCancel(true), AbilityActiveTime(0), bEndAbilityAfterActiveTime(false), bAbilityTagsAddedToBlockedTags(false)
 {
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_DeadState));
-	ActivationBlockedTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_StunState));
+	ActivationBlockedTags.AddTag(GlobalTag_DeadState);
+	ActivationBlockedTags.AddTag(GlobalTag_StunState);
 
 	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
 
 	bIsCancelable = true;
 
 	CostGameplayEffectClass = UPECostEffect::StaticClass();
-	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(FGameplayTag::RequestGameplayTag(GlobalTag_SetByCallerDuration), 0.f));
-	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(FGameplayTag::RequestGameplayTag(GlobalTag_SetByCallerHealth), 0.f));
-	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(FGameplayTag::RequestGameplayTag(GlobalTag_SetByCallerStamina), 0.f));
-	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(FGameplayTag::RequestGameplayTag(GlobalTag_SetByCallerMana), 0.f));
+	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(GlobalTag_SetByCallerDuration, 0.f));
+	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(GlobalTag_SetByCallerHealth, 0.f));
+	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(GlobalTag_SetByCallerStamina, 0.f));
+	AbilityCostSetByCallerData.Add(TPair<FGameplayTag, float>(GlobalTag_SetByCallerMana, 0.f));
 		
 	CooldownGameplayEffectClass = UPECooldownEffect::StaticClass();
-	AbilityCooldownSetByCallerData.Add(TPair<FGameplayTag, float>(FGameplayTag::RequestGameplayTag(GlobalTag_SetByCallerDuration), 0.f));
+	AbilityCooldownSetByCallerData.Add(TPair<FGameplayTag, float>(GlobalTag_SetByCallerDuration, 0.f));
 
-	SetByCallerCooldownTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_GenericCooldown));
+	SetByCallerCooldownTags.AddTag(GlobalTag_GenericCooldown);
+}
+
+#if WITH_EDITOR
+void UPEGameplayAbility::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Defaults changed: the profile will be rebuilt on next use and the ability tags appended again to the edited blocked tags
+	ActivationProfile.Reset();
+	bAbilityTagsAddedToBlockedTags = false;
+}
+#endif WITH_EDITOR
+
+const FPEAbilityActivationProfile& UPEGameplayAbility::GetActivationProfile() const
+{
+	if (!ActivationProfile.IsValid())
+	{
+		// The profile is owned by the class default object and shared with all instances of this class
+		const UPEGameplayAbility* const DefaultObject = GetClass()->GetDefaultObject<UPEGameplayAbility>();
+		if (!DefaultObject->ActivationProfile.IsValid())
+		{
+			DefaultObject->ActivationProfile = DefaultObject->BuildActivationProfile();
+		}
+
+		ActivationProfile = DefaultObject->ActivationProfile;
+	}
+
+	return *ActivationProfile.Get();
+}
+
+TSharedRef<const FPEAbilityActivationProfile> UPEGameplayAbility::BuildActivationProfile() const
+{
+	const TSharedRef<FPEAbilityActivationProfile> Profile = MakeShared<FPEAbilityActivationProfile>();
+
+	Profile->bUseSetByCallerCost = CostGameplayEffectClass && !AbilityCostSetByCallerData.IsEmpty();
+	Profile->bUseSetByCallerCooldown = CooldownGameplayEffectClass && !AbilityCooldownSetByCallerData.IsEmpty();
+
+	if (const FGameplayTagContainer* const CooldownTags = GetCooldownTags())
+	{
+		Profile->CooldownTags = *CooldownTags;
+		Profile->CooldownTags.RemoveTag(GlobalTag_GenericCooldown);
+	}
+
+	Profile->InterruptTags.AddTag(GlobalTag_DeadState);
+	Profile->InterruptTags.AddTag(GlobalTag_StunState);
+
+	const auto ResolveSetByCallerData = [](const TMap<FGameplayTag, float>& InData, TArray<TPair<FGameplayTag, float>>& OutData) -> void
+	{
+		OutData.Reserve(InData.Num());
+		for (const TPair<FGameplayTag, float>& StackedData : InData)
+		{
+			if (StackedData.Key.IsValid())
+			{
+				OutData.Add(StackedData);
+			}
+		}
+	};
+
+	ResolveSetByCallerData(AbilityCostSetByCallerData, Profile->CostSetByCallerData);
+	ResolveSetByCallerData(AbilityCooldownSetByCallerData, Profile->CooldownSetByCallerData);
+
+	// Cache the cost modifiers layout: CheckCost will only need to read the attribute values
+	if (const UGameplayEffect* const CostEffect = Profile->bUseSetByCallerCost ? GetCostGameplayEffect() : nullptr)
+	{
+		Profile->bCostModifiersResolved = true;
+
+		for (const FGameplayModifierInfo& ModDef : CostEffect->Modifiers)
+		{
+			if (ModDef.ModifierOp != EGameplayModOp::Additive || !ModDef.Attribute.IsValid())
+			{
+				continue;
+			}
+
+			FPECostModifierData& CostModifier = Profile->CostModifiers.AddDefaulted_GetRef();
+			CostModifier.Attribute = ModDef.Attribute;
+			CostModifier.Magnitude = ModDef.ModifierMagnitude;
+
+			switch (ModDef.ModifierMagnitude.GetMagnitudeCalculationType())
+			{
+				case EGameplayEffectMagnitudeCalculation::ScalableFloat:
+					break;
+
+				case EGameplayEffectMagnitudeCalculation::SetByCaller:
+				{
+					const FGameplayTag& DataTag = ModDef.ModifierMagnitude.GetSetByCallerFloat().DataTag;
+					if (!DataTag.IsValid())
+					{
+						Profile->bCostModifiersResolved = false;
+						break;
+					}
+
+					CostModifier.bIsSetByCaller = true;
+					CostModifier.SetByCallerMagnitude = AbilityCostSetByCallerData.FindRef(DataTag);
+					break;
+				}
+
+				default:
+					Profile->bCostModifiersResolved = false;
+					break;
+			}
+		}
+	}
+
+	return Profile;
 }
 
 void UPEGameplayAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
@@ -53,13 +161,20 @@ void UPEGameplayAbility::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInf
 
 	Super::OnGiveAbility(ActorInfo, Spec);
 
+	// Channels enabled in the regeneration subsystem would regenerate twice with the periodic regeneration abilities active
+	if (UPERegenerationSubsystem::IsReplacedRegenerationAbility(AbilityTags))
+	{
+		ABILITY_VLOG(this, Display, TEXT("Ability %s not activated: Regeneration is handled by the regeneration subsystem."), *GetName());
+		return;
+	}
+
 	// If the ability failed to activate on granting, will notify the ability system component
 	if (bAutoActivateOnGrant && !ActorInfo->AbilitySystemComponent->TryActivateAbility(Spec.Handle))
 	{
 		const TArray<FGameplayTag> FailureTags = 
 		{
-			FGameplayTag::RequestGameplayTag("GameplayAbility.Fail.OnGive"), 
-			FGameplayTag::RequestGameplayTag("GameplayAbility.Fail.TryActivate")
+			GlobalTag_AbilityFail_OnGive, 
+			GlobalTag_AbilityFail_TryActivate
 		};
 		
 		const FGameplayTagContainer FailureContainer = FGameplayTagContainer::CreateFromArray(FailureTags);
@@ -75,6 +190,8 @@ void UPEGameplayAbility::OnRemoveAbility(const FGameplayAbilityActorInfo* ActorI
 
 void UPEGameplayAbility::PreActivate(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, FOnGameplayAbilityEnded::FDelegate* OnGameplayAbilityEndedDelegate, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(PreActivate, GetClass());
+
 	ABILITY_VLOG(this, Display, TEXT("Trying pre-activate %s ability."), *GetName());
 
 	Super::PreActivate(Handle, ActorInfo, ActivationInfo, OnGameplayAbilityEndedDelegate, TriggerEventData);
@@ -85,19 +202,19 @@ void UPEGameplayAbility::PreActivate(const FGameplayAbilitySpecHandle Handle, co
 	
 	if (!bCanCommitAbility || !bFailsWithAuthority)
 	{
-		TArray FailureTags{FGameplayTag::RequestGameplayTag("GameplayAbility.Fail.PreActivate"),};
+		TArray<FGameplayTag> FailureTags{GlobalTag_AbilityFail_PreActivate,};
 
 		if (!bCanCommitAbility)
 		{
-			FailureTags.Add(FGameplayTag::RequestGameplayTag("GameplayAbility.Fail.CommitCheck"));
+			FailureTags.Add(GlobalTag_AbilityFail_CommitCheck);
 		}
 		if (!bFailsWithAuthority)
 		{
-			FailureTags.Add(FGameplayTag::RequestGameplayTag("GameplayAbility.Fail.HasAuthorityOrPredictionKey"));
+			FailureTags.Add(GlobalTag_AbilityFail_AuthorityOrPredictionKey);
 		}
 		if (GetCooldownTimeRemaining() > 0.f)
 		{
-			FailureTags.Add(FGameplayTag::RequestGameplayTag("GameplayAbility.Fail.Cooldown"));
+			FailureTags.Add(GlobalTag_AbilityFail_Cooldown);
 		}
 
 		const FGameplayTagContainer FailureContainer = FGameplayTagContainer::CreateFromArray(FailureTags);
@@ -107,20 +224,24 @@ void UPEGameplayAbility::PreActivate(const FGameplayAbilitySpecHandle Handle, co
 		return;
 	}
 
-	ActivationBlockedTags.AppendTags(AbilityTags);
+	const FPEAbilityActivationProfile& Profile = GetActivationProfile();
+
+	// Merged into the instance tags: Runtime changes made to this ability blocked tags are kept
+	if (!bAbilityTagsAddedToBlockedTags)
+	{
+		ActivationBlockedTags.AppendTags(AbilityTags);
+		bAbilityTagsAddedToBlockedTags = true;
+	}
 
 	// Auto cancel can only be called on instantiated abilities. Non-Instantiated abilities can't handle tasks
 	if (IsInstantiated())
 	{
-		UAbilityTask_WaitGameplayTagAdded* const WaitDeadTagAddedTask = UAbilityTask_WaitGameplayTagAdded::WaitGameplayTagAdd(this, FGameplayTag::RequestGameplayTag(GlobalTag_DeadState));
-
-		WaitDeadTagAddedTask->Added.AddDynamic(this, &UPEGameplayAbility::K2_EndAbility);
-		WaitDeadTagAddedTask->ReadyForActivation();
-
-		UAbilityTask_WaitGameplayTagAdded* const WaitStunTagAddedTask = UAbilityTask_WaitGameplayTagAdded::WaitGameplayTagAdd(this, FGameplayTag::RequestGameplayTag(GlobalTag_StunState));
-
-		WaitStunTagAddedTask->Added.AddDynamic(this, &UPEGameplayAbility::K2_EndAbility);
-		WaitStunTagAddedTask->ReadyForActivation();
+		// The owner will end this ability when one of the interrupt tags is added
+		if (UPEAbilitySystemComponent* const OwningComp = Cast<UPEAbilitySystemComponent>(ActorInfo->AbilitySystemComponent.Get());
+			IsValid(OwningComp) && !Profile.InterruptTags.IsEmpty())
+		{
+			OwningComp->RegisterInterruptibleAbility(this);
+		}
 
 		if (CanBeCanceled() && bWaitCancel)
 		{
@@ -128,31 +249,20 @@ void UPEGameplayAbility::PreActivate(const FGameplayAbilitySpecHandle Handle, co
 		}
 	}
 
-	// If auto cancel by time is active (by some undef reason), try to clear the timer and invalidate the handle
-	if (CancelationTimerHandle.IsValid())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(CancelationTimerHandle);
-		CancelationTimerHandle.Invalidate();
-	}
+	// If auto cancel by time is active (by some undef reason), try to clear the schedule and invalidate the handle
+	ClearEndAbilitySchedule();
 
 	// If the ability is time based, will cancel after active time
 	if (bEndAbilityAfterActiveTime)
 	{
-		FTimerDelegate TimerDelegate;
-		TimerDelegate.BindLambda([=]() -> void
-		{
-			if (IsValid(this) && IsActive())
-			{
-				EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
-			}
-		});
-
-		GetWorld()->GetTimerManager().SetTimer(CancelationTimerHandle, TimerDelegate, AbilityActiveTime, false);
+		ScheduleEndAbility(AbilityActiveTime);
 	}
 }
 
 void UPEGameplayAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+	PE_GAS_PROFILE_SCOPE(ActivateAbility, GetClass());
+
 	ABILITY_VLOG(this, Display, TEXT("%s ability successfully activated."), *GetName());
 
 	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
@@ -160,6 +270,8 @@ void UPEGameplayAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle
 
 void UPEGameplayAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const bool bReplicateEndAbility, const bool bWasCancelled)
 {
+	PE_GAS_PROFILE_SCOPE(EndAbility, GetClass());
+
 	if (!IsEndAbilityValid(Handle, ActorInfo))
 	{
 		return;
@@ -174,12 +286,8 @@ void UPEGameplayAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, con
 
 	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 
-	// If auto cancel by time is active, try to clear the timer and invalidate the handle
-	if (CancelationTimerHandle.IsValid())
-	{
-		GetWorld()->GetTimerManager().ClearTimer(CancelationTimerHandle);
-		CancelationTimerHandle.Invalidate();
-	}
+	// If auto cancel by time is active, try to clear the schedule and invalidate the handle
+	ClearEndAbilitySchedule();
 
 	UAbilitySystemComponent* const OwningComp = ActorInfo->AbilitySystemComponent.Get();
 
@@ -188,6 +296,11 @@ void UPEGameplayAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, con
 		return;
 	}
 
+	if (UPEAbilitySystemComponent* const OwningGASC = Cast<UPEAbilitySystemComponent>(OwningComp))
+	{
+		OwningGASC->UnregisterInterruptibleAbility(this);
+	}
+
 	// Remove active time based cost effects
 	if (IsValid(GetCostGameplayEffect()) && GetCostGameplayEffect()->DurationPolicy == EGameplayEffectDurationType::Infinite)
 	{
@@ -241,40 +354,43 @@ void UPEGameplayAbility::CommitExecute(const FGameplayAbilitySpecHandle Handle,
 
 void UPEGameplayAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
 {
-	if (AbilityCooldownSetByCallerData.IsEmpty() || !CooldownGameplayEffectClass)
+	PE_GAS_PROFILE_SCOPE(ApplyCooldown, GetClass());
+
+	const FPEAbilityActivationProfile& Profile = GetActivationProfile();
+
+	if (!Profile.bUseSetByCallerCooldown)
 	{
 		Super::ApplyCooldown(Handle, ActorInfo, ActivationInfo);
 	}
 	else if (const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, ActivationInfo, CooldownGameplayEffectClass, GetAbilityLevel(Handle, ActorInfo));
 		SpecHandle.IsValid())
 	{
-		FGameplayTagContainer CooldownTags_Copy = *GetCooldownTags();
-		CooldownTags_Copy.RemoveTag(FGameplayTag::RequestGameplayTag(GlobalTag_GenericCooldown));	
-
-		SpecHandle.Data->DynamicGrantedTags.AppendTags(CooldownTags_Copy);
+		SpecHandle.Data->DynamicGrantedTags.AppendTags(Profile.CooldownTags);
 		
-		ApplySetByCallerParamsToEffectSpec(AbilityCooldownSetByCallerData, SpecHandle.Data);
+		ApplySetByCallerParamsToEffectSpec(Profile.CooldownSetByCallerData, SpecHandle.Data);
 		ApplyGameplayEffectSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
 	}
 }
 
 bool UPEGameplayAbility::CheckCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, OUT FGameplayTagContainer* OptionalRelevantTags) const
 {
-	if (AbilityCooldownSetByCallerData.IsEmpty() || !CooldownGameplayEffectClass)
+	PE_GAS_PROFILE_SCOPE(CheckCooldown, GetClass());
+
+	const FPEAbilityActivationProfile& Profile = GetActivationProfile();
+
+	if (!Profile.bUseSetByCallerCooldown)
 	{
 		return Super::CheckCooldown(Handle, ActorInfo, OptionalRelevantTags);
 	}
 
-	FGameplayTagContainer CooldownTags_Copy = *GetCooldownTags();
-	CooldownTags_Copy.RemoveTag(FGameplayTag::RequestGameplayTag(GlobalTag_GenericCooldown));
-	if (CooldownTags_Copy.IsEmpty())
+	if (Profile.CooldownTags.IsEmpty())
 	{
 		return true;
 	}
 
 	if (const UAbilitySystemComponent* const AbilitySystemComponent = ActorInfo->AbilitySystemComponent.Get())
 	{
-		return !AbilitySystemComponent->HasAnyMatchingGameplayTags(CooldownTags_Copy);
+		return !AbilitySystemComponent->HasAnyMatchingGameplayTags(Profile.CooldownTags);
 	}
 
 	return true;
@@ -292,29 +408,71 @@ const FGameplayTagContainer* UPEGameplayAbility::GetCooldownTags() const
 
 void UPEGameplayAbility::ApplyCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
 {
-	if (AbilityCostSetByCallerData.IsEmpty() || !CostGameplayEffectClass)
+	PE_GAS_PROFILE_SCOPE(ApplyCost, GetClass());
+
+	const FPEAbilityActivationProfile& Profile = GetActivationProfile();
+
+	if (!Profile.bUseSetByCallerCost)
 	{
 		Super::ApplyCost(Handle, ActorInfo, ActivationInfo);
 	}
 	else if (const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, ActivationInfo, CostGameplayEffectClass, GetAbilityLevel(Handle, ActorInfo));
 		SpecHandle.IsValid())
 	{
-		ApplySetByCallerParamsToEffectSpec(AbilityCostSetByCallerData, SpecHandle.Data);
+		ApplySetByCallerParamsToEffectSpec(Profile.CostSetByCallerData, SpecHandle.Data);
 		ApplyGameplayEffectSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
 	}
 }
 
 bool UPEGameplayAbility::CheckCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, OUT FGameplayTagContainer* OptionalRelevantTags) const
 {
-	if (AbilityCostSetByCallerData.IsEmpty() || !CostGameplayEffectClass)
+	PE_GAS_PROFILE_SCOPE(CheckCost, GetClass());
+
+	const FPEAbilityActivationProfile& Profile = GetActivationProfile();
+
+	if (!Profile.bUseSetByCallerCost)
 	{
 		return Super::CheckCost(Handle, ActorInfo, OptionalRelevantTags);
 	}
+
+	// Fast path: compare the cached cost modifiers with the current attribute values
+	if (Profile.bCostModifiersResolved)
+	{
+		const UAbilitySystemComponent* const TargetABSC = ActorInfo->AbilitySystemComponent.Get();
+		if (!IsValid(TargetABSC))
+		{
+			return false;
+		}
+
+		const float AbilityLevel = GetAbilityLevel(Handle, ActorInfo);
+
+		for (const FPECostModifierData& CostModifier : Profile.CostModifiers)
+		{
+			const UAttributeSet* const Set = TargetABSC->GetAttributeSet(CostModifier.Attribute.GetAttributeSetClass());
+			if (!IsValid(Set))
+			{
+				return false;
+			}
+
+			float CostValue = CostModifier.SetByCallerMagnitude;
+			if (!CostModifier.bIsSetByCaller)
+			{
+				CostModifier.Magnitude.GetStaticMagnitudeIfPossible(AbilityLevel, CostValue);
+			}
+
+			if (CostModifier.Attribute.GetNumericValueChecked(Set) + CostValue < 0.f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
 	
-	else if (const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, FGameplayAbilityActivationInfo(), CostGameplayEffectClass, GetAbilityLevel(Handle, ActorInfo));
+	if (const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, FGameplayAbilityActivationInfo(), CostGameplayEffectClass, GetAbilityLevel(Handle, ActorInfo));
 		SpecHandle.IsValid())
 	{
-		ApplySetByCallerParamsToEffectSpec(AbilityCostSetByCallerData, SpecHandle.Data);
+		ApplySetByCallerParamsToEffectSpec(Profile.CostSetByCallerData, SpecHandle.Data);
 
 		UAbilitySystemComponent* const TargetABSC = ActorInfo->AbilitySystemComponent.Get();
 		if (!IsValid(TargetABSC))
@@ -365,6 +523,14 @@ void UPEGameplayAbility::ApplySetByCallerParamsToEffectSpec(const TMap<FGameplay
 	}
 }
 
+void UPEGameplayAbility::ApplySetByCallerParamsToEffectSpec(const TArrayView<const TPair<FGameplayTag, float>> SetByCallerData, const TSharedPtr<FGameplayEffectSpec>& EffectSpec) const
+{
+	for (const TPair<FGameplayTag, float>& StackedData : SetByCallerData)
+	{
+		EffectSpec.Get()->SetSetByCallerMagnitude(StackedData.Key, StackedData.Value);
+	}
+}
+
 void UPEGameplayAbility::ActivateGameplayCues(const FGameplayTag GameplayCueTag, FGameplayCueParameters Parameters, UAbilitySystemComponent* SourceAbilitySystem)
 {
 	if (SourceAbilitySystem == nullptr)
@@ -408,7 +574,7 @@ void UPEGameplayAbility::ApplyAbilityEffectsToSelf(const FGameplayAbilitySpecHan
 		if (const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, ActivationInfo, EffectGroup.EffectClass, GetAbilityLevel(Handle, ActorInfo));
 			SpecHandle.IsValid())
 		{
-			ApplySetByCallerParamsToEffectSpec(EffectGroup.SetByCallerStackedData, SpecHandle.Data);
+			ApplySetByCallerParamsToEffectSpec(EffectGroup.GetSetByCallerData(), SpecHandle.Data);
 			ApplyGameplayEffectSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
 		}
 	}
@@ -445,17 +611,31 @@ void UPEGameplayAbility::ApplyAbilityEffectsToTarget(const FGameplayAbilityTarge
 {
 	ABILITY_VLOG(this, Display, TEXT("Applying %s ability effects to targets."), *GetName());
 
+	// Already batched: One spec per effect is shared by every target in the handle
+	// Not routed through ApplyEffectGroupedDataToTargets because the ability spec carries the ability level and context
 	for (const FGameplayEffectGroupedData& EffectGroup : TargetAbilityEffects)
 	{
 		if (const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, ActivationInfo, EffectGroup.EffectClass, GetAbilityLevel(Handle, ActorInfo));
 			SpecHandle.IsValid())
 		{
-			ApplySetByCallerParamsToEffectSpec(EffectGroup.SetByCallerStackedData, SpecHandle.Data);
+			ApplySetByCallerParamsToEffectSpec(EffectGroup.GetSetByCallerData(), SpecHandle.Data);
 			ApplyGameplayEffectSpecToTarget(Handle, ActorInfo, ActivationInfo, SpecHandle, TargetDataHandle);
 		}
 	}
 }
 
+void UPEGameplayAbility::BP_ApplyAbilityEffectsToHitResults(const TArray<FHitResult>& HitResults)
+{
+	check(CurrentActorInfo);
+
+	if (HitResults.IsEmpty())
+	{
+		return;
+	}
+
+	ApplyAbilityEffectsToTarget(UPEAbilityFunctions::MakeMultiHitTargetDataHandleFromHitResultArray(HitResults), CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo);
+}
+
 void UPEGameplayAbility::BP_SpawnProjectileWithTargetEffects(const TSubclassOf<APEProjectileActor> ProjectileClass, const FTransform ProjectileTransform, const FVector ProjectileFireDirection)
 {
 	check(CurrentActorInfo);
@@ -510,6 +690,44 @@ void UPEGameplayAbility::PlayAbilitySoundAtLocation(const UObject* WorldContext,
 	UGameplayStatics::SpawnSoundAtLocation(WorldContext, AbilitySoundData.AbilitySoundFX, InLocation, FRotator::ZeroRotator, AbilitySoundData.VolumeMultiplier, AbilitySoundData.PitchMultiplier, AbilitySoundData.StartTime);
 }
 
+void UPEGameplayAbility::ScheduleEndAbility(const float InTime)
+{
+	ClearEndAbilitySchedule();
+
+	// Resolve from the ability world: The avatar may already be gone while the ability is still active
+	UPETimingWheelSubsystem* const TimingWheel = UPETimingWheelSubsystem::Get(this);
+	if (!IsValid(TimingWheel))
+	{
+		ABILITY_VLOG(this, Warning, TEXT("Ability %s failed to schedule its end due to invalid timing wheel."), *GetName());
+		return;
+	}
+
+	CancelationTimerHandle = TimingWheel->Schedule(InTime, FSimpleDelegate::CreateWeakLambda(this, [this]
+	{
+		CancelationTimerHandle.Invalidate();
+
+		if (IsActive())
+		{
+			EndAbility(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo(), true, false);
+		}
+	}));
+}
+
+void UPEGameplayAbility::ClearEndAbilitySchedule()
+{
+	if (!CancelationTimerHandle.IsValid())
+	{
+		return;
+	}
+
+	if (UPETimingWheelSubsystem* const TimingWheel = UPETimingWheelSubsystem::Get(this))
+	{
+		TimingWheel->Cancel(CancelationTimerHandle);
+	}
+
+	CancelationTimerHandle.Invalidate();
+}
+
 void UPEGameplayAbility::ActivateWaitMontageTask(const FName MontageSection, const float Rate, const bool bRandomSection, const bool bStopsWhenAbilityEnds)
 {
 	FName MontageSectionName = MontageSection;
@@ -537,14 +755,15 @@ void UPEGameplayAbility::ActivateWaitTargetDataTask(const TEnumAsByte<EGameplayT
 
 	TargetParameters.Range = AbilityMaxRange;
 
-	UAbilityTask_WaitTargetData* const AbilityTask_WaitTargetData = UAbilityTask_WaitTargetData::WaitTargetData(this, "WaitTargetDataTask", TargetingConfirmation, TargetActorClass);
+	// Targeting actors are reused from the ability system component pool instead of being spawned on every activation
+	UPEWaitTargetData_Task* const AbilityTask_WaitTargetData = UPEWaitTargetData_Task::WaitPooledTargetData(this, "WaitTargetDataTask", TargetingConfirmation, TargetActorClass);
 
 	AbilityTask_WaitTargetData->Cancelled.AddDynamic(this, &UPEGameplayAbility::WaitTargetData_Callback);
 	AbilityTask_WaitTargetData->ValidData.AddDynamic(this, &UPEGameplayAbility::WaitTargetData_Callback);
 
 	// Initialize the spawning task with the TargetActor
 	if (AGameplayAbilityTargetActor* TargetActor = nullptr;
-		AbilityTask_WaitTargetData->BeginSpawningActor(this, TargetActorClass, TargetActor))
+		AbilityTask_WaitTargetData->BeginSpawningPooledActor(this, TargetActorClass, TargetActor))
 	{
 		TargetActor->StartLocation = TargetParameters.StartLocation;
 		TargetActor->ReticleClass = TargetParameters.ReticleClass;
@@ -574,7 +793,7 @@ void UPEGameplayAbility::ActivateWaitTargetDataTask(const TEnumAsByte<EGameplayT
 			}
 		}
 
-		AbilityTask_WaitTargetData->FinishSpawningActor(this, TargetActor);
+		AbilityTask_WaitTargetData->FinishSpawningPooledActor(this, TargetActor);
 		TargetActor->bDestroyOnConfirmation = TargetParameters.bDestroyOnConfirmation;
 		AbilityTask_WaitTargetData->ReadyForActivation();
 	}
@@ -584,11 +803,11 @@ void UPEGameplayAbility::ActivateWaitTargetDataTask(const TEnumAsByte<EGameplayT
 	{
 		UAbilitySystemComponent* const Comp = GetAbilitySystemComponentFromActorInfo_Checked();
 
-		Comp->AddLooseGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_AimingState));
-		Comp->AddLooseGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingConfirmationState));
+		Comp->AddLooseGameplayTag(GlobalTag_AimingState);
+		Comp->AddLooseGameplayTag(GlobalTag_WaitingConfirmationState);
 
-		AbilityExtraTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_AimingState));
-		AbilityExtraTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingConfirmationState));
+		AbilityExtraTags.AddTag(GlobalTag_AimingState);
+		AbilityExtraTags.AddTag(GlobalTag_WaitingConfirmationState);
 	}
 }
 
@@ -596,10 +815,10 @@ void UPEGameplayAbility::ActivateWaitConfirmInputTask()
 {
 	// Add extra tag to the ability system component to tell that we are waiting for confirm input
 	UAbilitySystemComponent* const Comp = GetAbilitySystemComponentFromActorInfo_Checked();
-	if (!AbilityExtraTags.HasTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingConfirmationState)))
+	if (!AbilityExtraTags.HasTag(GlobalTag_WaitingConfirmationState))
 	{
-		Comp->AddLooseGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingConfirmationState));
-		AbilityExtraTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingConfirmationState));
+		Comp->AddLooseGameplayTag(GlobalTag_WaitingConfirmationState);
+		AbilityExtraTags.AddTag(GlobalTag_WaitingConfirmationState);
 	}
 
 	UAbilityTask_WaitConfirmCancel* const AbilityTask_WaitConfirm = UAbilityTask_WaitConfirmCancel::WaitConfirmCancel(this);
@@ -620,10 +839,10 @@ void UPEGameplayAbility::ActivateWaitCancelInputTask()
 {
 	// Add extra tag to the ability system component to tell that we are waiting for cancel input
 	UAbilitySystemComponent* const Comp = GetAbilitySystemComponentFromActorInfo_Checked();
-	if (!AbilityExtraTags.HasTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingCancelationState)))
+	if (!AbilityExtraTags.HasTag(GlobalTag_WaitingCancelationState))
 	{
-		Comp->AddLooseGameplayTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingCancelationState));
-		AbilityExtraTags.AddTag(FGameplayTag::RequestGameplayTag(GlobalTag_WaitingCancelationState));
+		Comp->AddLooseGameplayTag(GlobalTag_WaitingCancelationState);
+		AbilityExtraTags.AddTag(GlobalTag_WaitingCancelationState);
 	}
 
 	UAbilityTask_WaitCancel* const AbilityTask_WaitCancel = UAbilityTask_WaitCancel::WaitCancel(this);
@@ -665,6 +884,15 @@ void UPEGameplayAbility::ActivateSpawnActorTask(const FGameplayAbilityTargetData
 	AbilityTask_SpawnActor->ReadyForActivation();
 }
 
+void UPEGameplayAbility::InterruptAbility()
+{
+	if (IsActive())
+	{
+		ABILITY_VLOG(this, Display, TEXT("%s ability interrupted by owner state."), *GetName());
+		K2_EndAbility();
+	}
+}
+
 void UPEGameplayAbility::WaitCancelInput_Callback()
 {
 	if (CanBeCanceled())
@@ -0,0 +1,57 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/Targeting/PEAsyncGroundTargeting.h"
+#include <Abilities/GameplayAbilityWorldReticle.h>
+
+APEAsyncGroundTargeting::APEAsyncGroundTargeting(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+}
+
+void APEAsyncGroundTargeting::StartTargeting(UGameplayAbility* Ability)
+{
+	Super::StartTargeting(Ability);
+
+	AsyncTrace.Reset();
+	AsyncTrace.SetGroundProjection(true, CollisionHeightOffset);
+}
+
+FHitResult APEAsyncGroundTargeting::PerformTrace(AActor* InSourceActor)
+{
+	// The aim trace is a line trace: The collision shape is only used to adjust the ground result
+	AsyncTrace.Request(*this, FCollisionShape());
+
+	// Nothing completed yet (e.g. instant confirmation): Use the synchronous traces
+	if (!AsyncTrace.HasResult())
+	{
+		return Super::PerformTrace(InSourceActor);
+	}
+
+	FHitResult HitResult = AsyncTrace.GetResult();
+
+	// Same validation of AGameplayAbilityTargetActor_GroundTrace::PerformTrace: This step still uses a synchronous sweep
+	bLastTraceWasGood = true;
+
+	if (CollisionShape.ShapeType != ECollisionShape::Line)
+	{
+		HitResult.Location.Z += CollisionHeightOffset;
+		bLastTraceWasGood = AdjustCollisionHitResultZ(HitResult);
+
+		if (bLastTraceWasGood)
+		{
+			HitResult.Location.Z -= CollisionHeightOffset;
+		}
+	}
+
+	if (AGameplayAbilityWorldReticle* const LocalReticleActor = ReticleActor.Get())
+	{
+		LocalReticleActor->SetIsTargetValid(bLastTraceWasGood);
+		LocalReticleActor->SetActorLocation(HitResult.Location);
+	}
+
+	// The target data uses the targeting origin, not the start of the ground trace
+	HitResult.TraceStart = StartLocation.GetTargetingTransform().GetLocation();
+
+	return HitResult;
+}
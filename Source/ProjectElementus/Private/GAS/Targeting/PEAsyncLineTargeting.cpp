@@ -0,0 +1,33 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/Targeting/PEAsyncLineTargeting.h"
+#include <Abilities/GameplayAbilityWorldReticle.h>
+
+APEAsyncLineTargeting::APEAsyncLineTargeting(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+}
+
+void APEAsyncLineTargeting::StartTargeting(UGameplayAbility* Ability)
+{
+	Super::StartTargeting(Ability);
+
+	AsyncTrace.Reset();
+}
+
+FHitResult APEAsyncLineTargeting::PerformTrace(AActor* InSourceActor)
+{
+	AsyncTrace.Request(*this, FCollisionShape());
+
+	// Nothing completed yet (e.g. instant confirmation): Use a single synchronous trace
+	if (!AsyncTrace.HasResult())
+	{
+		return Super::PerformTrace(InSourceActor);
+	}
+
+	const FHitResult& HitResult = AsyncTrace.GetResult();
+	FPEAsyncTargetingTrace::UpdateReticle(ReticleActor.Get(), HitResult);
+
+	return HitResult;
+}
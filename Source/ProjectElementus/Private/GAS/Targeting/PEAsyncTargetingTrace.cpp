@@ -0,0 +1,255 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/Targeting/PEAsyncTargetingTrace.h"
+#include "Management/ProjectElementus.h"
+#include <Abilities/GameplayAbility.h>
+#include <Abilities/GameplayAbilityTargetActor_Trace.h>
+#include <Abilities/GameplayAbilityWorldReticle.h>
+#include <Engine/World.h>
+#include <GameFramework/PlayerController.h>
+
+DECLARE_CYCLE_STAT(TEXT("Async Targeting Request"), STAT_PEAsyncTargetingRequest, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async Targeting Traces"), STAT_PEAsyncTargetingTraces, STATGROUP_ProjectElementus);
+
+void FPEAsyncTargetingTrace::Request(AGameplayAbilityTargetActor_Trace& InTargetActor, const FCollisionShape& InShape)
+{
+	// Tick and confirmation may request traces in the same frame
+	if (LastRequestFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_PEAsyncTargetingRequest);
+
+	UWorld* const World = InTargetActor.GetWorld();
+	if (!IsValid(World) || !IsValid(InTargetActor.SourceActor))
+	{
+		return;
+	}
+
+	LastRequestFrame = GFrameCounter;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(PEAsyncTargetingTrace), false);
+	Params.bReturnPhysicalMaterial = true;
+	Params.AddIgnoredActor(InTargetActor.SourceActor);
+	Params.AddIgnoredActor(&InTargetActor);
+
+	const FVector TraceStart = InTargetActor.StartLocation.GetTargetingTransform().GetLocation();
+
+	// The aim point resolved by the previous frame is used to aim this frame targeting trace
+	RequestAimTrace(InTargetActor, Params, TraceStart);
+	const FVector TraceEnd = ResolveTraceEnd(InTargetActor, TraceStart);
+
+	FTraceDelegate TargetDelegate = FTraceDelegate::CreateWeakLambda(&InTargetActor, [this, &InTargetActor, Params](const FTraceHandle& Handle, FTraceDatum& Datum)
+	{
+		// Results of older requests are discarded
+		if (Handle != TargetHandle)
+		{
+			return;
+		}
+
+		TargetHandle = FTraceHandle();
+
+		FHitResult HitResult;
+		if (!FindFirstFilteredHit(InTargetActor, Datum, HitResult))
+		{
+			HitResult.Location = Datum.End;
+		}
+
+		// The result is only published after it reaches the ground
+		if (bProjectToGround)
+		{
+			RequestGroundTrace(InTargetActor, Params, HitResult);
+			return;
+		}
+
+		LatestResult = HitResult;
+		bHasResult = true;
+	});
+
+	if (InShape.IsNearlyZero())
+	{
+		TargetHandle = World->AsyncLineTraceByProfile(EAsyncTraceType::Multi, TraceStart, TraceEnd, InTargetActor.TraceProfile.Name, Params, &TargetDelegate);
+	}
+	else
+	{
+		TargetHandle = World->AsyncSweepByProfile(EAsyncTraceType::Multi, TraceStart, TraceEnd, FQuat::Identity, InTargetActor.TraceProfile.Name, InShape, Params, &TargetDelegate);
+	}
+
+	INC_DWORD_STAT(STAT_PEAsyncTargetingTraces);
+}
+
+bool FPEAsyncTargetingTrace::HasResult() const
+{
+	return bHasResult;
+}
+
+const FHitResult& FPEAsyncTargetingTrace::GetResult() const
+{
+	return LatestResult;
+}
+
+void FPEAsyncTargetingTrace::Reset()
+{
+	AimHandle = FTraceHandle();
+	TargetHandle = FTraceHandle();
+	GroundHandle = FTraceHandle();
+
+	ViewStart = FVector::ZeroVector;
+	ViewEnd = FVector::ZeroVector;
+
+	LatestResult = FHitResult();
+	LastRequestFrame = 0u;
+
+	bHasAimLocation = false;
+	bHasResult = false;
+}
+
+void FPEAsyncTargetingTrace::SetGroundProjection(const bool bInProjectToGround, const float InHeightOffset)
+{
+	bProjectToGround = bInProjectToGround;
+	GroundHeightOffset = InHeightOffset;
+}
+
+void FPEAsyncTargetingTrace::UpdateReticle(AGameplayAbilityWorldReticle* InReticle, const FHitResult& InHitResult)
+{
+	if (!IsValid(InReticle))
+	{
+		return;
+	}
+
+	const bool bHitActor = InHitResult.bBlockingHit && InHitResult.HitObjectHandle.IsValid();
+	const FVector ReticleLocation = bHitActor && InReticle->bSnapToTargetedActor ? InHitResult.HitObjectHandle.GetLocation() : InHitResult.Location;
+
+	InReticle->SetActorLocation(ReticleLocation);
+	InReticle->SetIsTargetAnActor(bHitActor);
+}
+
+void FPEAsyncTargetingTrace::RequestAimTrace(AGameplayAbilityTargetActor_Trace& InTargetActor, const FCollisionQueryParams& InParams, const FVector& InTraceStart)
+{
+	const APlayerController* const PlayerController = InTargetActor.OwningAbility ? InTargetActor.OwningAbility->GetCurrentActorInfo()->PlayerController.Get() : nullptr;
+	if (!IsValid(PlayerController))
+	{
+		return;
+	}
+
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(ViewStart, ViewRotation);
+
+	const FVector ViewDirection = ViewRotation.Vector();
+	ViewEnd = ViewStart + ViewDirection * InTargetActor.MaxRange;
+
+	AGameplayAbilityTargetActor_Trace::ClipCameraRayToAbilityRange(ViewStart, ViewDirection, InTraceStart, InTargetActor.MaxRange, ViewEnd);
+
+	FTraceDelegate AimDelegate = FTraceDelegate::CreateWeakLambda(&InTargetActor, [this, &InTargetActor](const FTraceHandle& Handle, FTraceDatum& Datum)
+	{
+		if (Handle != AimHandle)
+		{
+			return;
+		}
+
+		AimHandle = FTraceHandle();
+
+		FHitResult HitResult;
+		bHasAimLocation = FindFirstFilteredHit(InTargetActor, Datum, HitResult);
+		AimLocation = HitResult.Location;
+	});
+
+	AimHandle = InTargetActor.GetWorld()->AsyncLineTraceByProfile(EAsyncTraceType::Multi, ViewStart, ViewEnd, InTargetActor.TraceProfile.Name, InParams, &AimDelegate);
+
+	INC_DWORD_STAT(STAT_PEAsyncTargetingTraces);
+}
+
+void FPEAsyncTargetingTrace::RequestGroundTrace(AGameplayAbilityTargetActor_Trace& InTargetActor, const FCollisionQueryParams& InParams, const FHitResult& InTargetResult)
+{
+	UWorld* const World = InTargetActor.GetWorld();
+	if (!IsValid(World))
+	{
+		return;
+	}
+
+	// Same downward trace of AGameplayAbilityTargetActor_GroundTrace::PerformTrace: Pulled back slightly to avoid scraping down walls
+	FVector GroundStart = InTargetResult.Location - (InTargetResult.TraceEnd - InTargetResult.TraceStart).GetSafeNormal();
+	FVector GroundEnd = GroundStart;
+
+	GroundStart.Z += GroundHeightOffset;
+	GroundEnd.Z -= 99999.0f;
+
+	FTraceDelegate GroundDelegate = FTraceDelegate::CreateWeakLambda(&InTargetActor, [this, &InTargetActor, InTargetResult](const FTraceHandle& Handle, FTraceDatum& Datum)
+	{
+		if (Handle != GroundHandle)
+		{
+			return;
+		}
+
+		GroundHandle = FTraceHandle();
+
+		// Without ground below (e.g. outside of the map) the targeting result is kept, like the engine does
+		FHitResult HitResult = InTargetResult;
+		FindFirstFilteredHit(InTargetActor, Datum, HitResult);
+
+		LatestResult = HitResult;
+		bHasResult = true;
+	});
+
+	GroundHandle = World->AsyncLineTraceByProfile(EAsyncTraceType::Multi, GroundStart, GroundEnd, InTargetActor.TraceProfile.Name, InParams, &GroundDelegate);
+
+	INC_DWORD_STAT(STAT_PEAsyncTargetingTraces);
+}
+
+FVector FPEAsyncTargetingTrace::ResolveTraceEnd(const AGameplayAbilityTargetActor_Trace& InTargetActor, const FVector& InTraceStart) const
+{
+	const float MaxRange = InTargetActor.MaxRange;
+
+	// Without a player controller there's no view to aim with
+	if (ViewStart.Equals(ViewEnd))
+	{
+		return InTraceStart + InTargetActor.SourceActor->GetActorForwardVector() * MaxRange;
+	}
+
+	// Same rules of AGameplayAbilityTargetActor_Trace::AimWithPlayerController, using the aim point of the last completed camera trace
+	const bool bUseAimLocation = bHasAimLocation && FVector::DistSquared(InTraceStart, AimLocation) <= MaxRange * MaxRange;
+	const FVector AdjustedEnd = bUseAimLocation ? AimLocation : ViewEnd;
+
+	FVector AdjustedAimDirection = (AdjustedEnd - InTraceStart).GetSafeNormal();
+	if (AdjustedAimDirection.IsZero())
+	{
+		AdjustedAimDirection = (ViewEnd - ViewStart).GetSafeNormal();
+	}
+
+	if (!InTargetActor.bTraceAffectsAimPitch && bUseAimLocation)
+	{
+		if (const FVector OriginalAimDirection = (ViewEnd - InTraceStart).GetSafeNormal();
+			!OriginalAimDirection.IsZero())
+		{
+			FRotator AdjustedAimRotation = AdjustedAimDirection.Rotation();
+			AdjustedAimRotation.Pitch = OriginalAimDirection.Rotation().Pitch;
+
+			AdjustedAimDirection = AdjustedAimRotation.Vector();
+		}
+	}
+
+	return InTraceStart + AdjustedAimDirection * MaxRange;
+}
+
+bool FPEAsyncTargetingTrace::FindFirstFilteredHit(const AGameplayAbilityTargetActor_Trace& InTargetActor, const FTraceDatum& InDatum, FHitResult& OutHitResult)
+{
+	OutHitResult.TraceStart = InDatum.Start;
+	OutHitResult.TraceEnd = InDatum.End;
+
+	// Same filtering of AGameplayAbilityTargetActor_Trace::LineTraceWithFilter
+	for (const FHitResult& Hit : InDatum.OutHits)
+	{
+		if (!Hit.HitObjectHandle.IsValid() || InTargetActor.Filter.FilterPassesForActor(Hit.HitObjectHandle.FetchActor()))
+		{
+			OutHitResult = Hit;
+			OutHitResult.bBlockingHit = true;
+
+			return true;
+		}
+	}
+
+	return false;
+}
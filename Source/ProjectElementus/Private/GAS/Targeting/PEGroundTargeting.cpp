@@ -8,3 +8,18 @@ APEGroundTargeting::APEGroundTargeting(const FObjectInitializer& ObjectInitializ
 {
 	TraceProfile = FCollisionProfileName(TEXT("Target"));
 }
+
+void APEGroundTargeting::StartTargeting(UGameplayAbility* Ability)
+{
+	StartTargetingWithPooledReticle(this, ReticleActor, Ability, [this, Ability] { Super::StartTargeting(Ability); });
+}
+
+void APEGroundTargeting::OnAcquiredFromPool()
+{
+	AcquireFromPool(this);
+}
+
+void APEGroundTargeting::OnReleasedToPool()
+{
+	ReleaseToPool(this, ReticleActor);
+}
@@ -8,3 +8,18 @@ APELineTargeting::APELineTargeting(const FObjectInitializer& ObjectInitializer)
 {
 	TraceProfile = FCollisionProfileName(TEXT("Target"));
 }
+
+void APELineTargeting::StartTargeting(UGameplayAbility* Ability)
+{
+	StartTargetingWithPooledReticle(this, ReticleActor, Ability, [this, Ability] { Super::StartTargeting(Ability); });
+}
+
+void APELineTargeting::OnAcquiredFromPool()
+{
+	AcquireFromPool(this);
+}
+
+void APELineTargeting::OnReleasedToPool()
+{
+	ReleaseToPool(this, ReticleActor);
+}
@@ -0,0 +1,244 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/Targeting/PEMultiHitTargetData.h"
+#include "Management/ProjectElementus.h"
+#include <Components/SkinnedMeshComponent.h>
+#include <GameFramework/Actor.h>
+#include <HAL/IConsoleManager.h>
+#include <Serialization/BitWriter.h>
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Multi Hit Target Data Created"), STAT_PEMultiHitTargetDataCreated, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Multi Hit Target Data Hits Sent"), STAT_PEMultiHitTargetDataHitsSent, STATGROUP_ProjectElementus);
+
+/* Upper bound of hits accepted from the network */
+constexpr uint32 MultiHitMaxNetSerializedHits = 256u;
+
+bool FPECompactHitData::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	UObject* ActorObject = Actor.Get();
+	Ar << ActorObject;
+
+	UObject* ComponentObject = Component.Get();
+	Ar << ComponentObject;
+
+	bool bStartSuccess = true;
+	TraceStart.NetSerialize(Ar, Map, bStartSuccess);
+
+	bool bPointSuccess = true;
+	ImpactPoint.NetSerialize(Ar, Map, bPointSuccess);
+
+	bool bNormalSuccess = true;
+	ImpactNormal.NetSerialize(Ar, Map, bNormalSuccess);
+
+	Ar << Distance;
+
+	// Bones are sent with an offset of 1: INDEX_NONE is packed in a single byte
+	uint32 PackedBoneIndex = static_cast<uint32>(BoneIndex + 1);
+	Ar.SerializeIntPacked(PackedBoneIndex);
+
+	if (Ar.IsLoading())
+	{
+		Actor = Cast<AActor>(ActorObject);
+		Component = Cast<UPrimitiveComponent>(ComponentObject);
+		BoneIndex = static_cast<int32>(PackedBoneIndex) - 1;
+	}
+
+	bOutSuccess = bStartSuccess && bPointSuccess && bNormalSuccess;
+	return true;
+}
+
+FPEGameplayAbilityTargetData_MultiHit::FPEGameplayAbilityTargetData_MultiHit(const TArray<FHitResult>& InHitResults)
+{
+	INC_DWORD_STAT(STAT_PEMultiHitTargetDataCreated);
+
+	Hits.Reserve(InHitResults.Num());
+
+	for (const FHitResult& HitResult : InHitResults)
+	{
+		AddHit(HitResult);
+	}
+}
+
+void FPEGameplayAbilityTargetData_MultiHit::AddHit(const FHitResult& InHitResult)
+{
+	FPECompactHitData& Hit = Hits.AddDefaulted_GetRef();
+	Hit.Actor = InHitResult.GetActor();
+	Hit.Component = InHitResult.GetComponent();
+	Hit.TraceStart = InHitResult.TraceStart;
+	Hit.ImpactPoint = InHitResult.ImpactPoint;
+	Hit.ImpactNormal = InHitResult.ImpactNormal;
+	Hit.Distance = InHitResult.Distance;
+
+	if (const USkinnedMeshComponent* const SkinnedComponent = Cast<USkinnedMeshComponent>(InHitResult.GetComponent());
+		IsValid(SkinnedComponent) && InHitResult.BoneName != NAME_None)
+	{
+		Hit.BoneIndex = SkinnedComponent->GetBoneIndex(InHitResult.BoneName);
+	}
+}
+
+int32 FPEGameplayAbilityTargetData_MultiHit::GetNumHits() const
+{
+	return Hits.Num();
+}
+
+FHitResult FPEGameplayAbilityTargetData_MultiHit::GetHitResultAt(const int32 InIndex) const
+{
+	if (!Hits.IsValidIndex(InIndex))
+	{
+		return FHitResult();
+	}
+
+	const FPECompactHitData& Hit = Hits[InIndex];
+
+	FHitResult HitResult(Hit.Actor.Get(), Hit.Component.Get(), Hit.ImpactPoint, Hit.ImpactNormal);
+	HitResult.bBlockingHit = true;
+	HitResult.TraceStart = Hit.TraceStart;
+	HitResult.Distance = Hit.Distance;
+
+	// Bone indices are only valid for the skinned mesh that was hit
+	if (const USkinnedMeshComponent* const SkinnedComponent = Cast<USkinnedMeshComponent>(Hit.Component.Get());
+		IsValid(SkinnedComponent) && Hit.BoneIndex != INDEX_NONE)
+	{
+		HitResult.BoneName = SkinnedComponent->GetBoneName(Hit.BoneIndex);
+	}
+
+	return HitResult;
+}
+
+TArray<TWeakObjectPtr<AActor>> FPEGameplayAbilityTargetData_MultiHit::GetActors() const
+{
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	Actors.Reserve(Hits.Num());
+
+	for (const FPECompactHitData& Hit : Hits)
+	{
+		if (Hit.Actor.IsValid())
+		{
+			Actors.Add(Hit.Actor);
+		}
+	}
+
+	return Actors;
+}
+
+bool FPEGameplayAbilityTargetData_MultiHit::HasEndPoint() const
+{
+	return !Hits.IsEmpty();
+}
+
+FVector FPEGameplayAbilityTargetData_MultiHit::GetEndPoint() const
+{
+	return Hits.IsEmpty() ? FVector::ZeroVector : static_cast<FVector>(Hits[0].ImpactPoint);
+}
+
+void FPEGameplayAbilityTargetData_MultiHit::AddTargetDataToContext(FGameplayEffectContextHandle& Context, const bool bIncludeActorArray) const
+{
+	FGameplayAbilityTargetData::AddTargetDataToContext(Context, bIncludeActorArray);
+
+	if (!Hits.IsEmpty() && !Context.GetHitResult())
+	{
+		Context.AddHitResult(GetHitResultAt(0));
+	}
+}
+
+FString FPEGameplayAbilityTargetData_MultiHit::ToString() const
+{
+	return FString::Printf(TEXT("FPEGameplayAbilityTargetData_MultiHit: %d hits"), Hits.Num());
+}
+
+bool FPEGameplayAbilityTargetData_MultiHit::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	uint32 NumHits = static_cast<uint32>(Hits.Num());
+	Ar.SerializeIntPacked(NumHits);
+
+	if (Ar.IsLoading())
+	{
+		if (NumHits > MultiHitMaxNetSerializedHits)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+
+			return false;
+		}
+
+		Hits.SetNum(NumHits);
+	}
+	else
+	{
+		INC_DWORD_STAT_BY(STAT_PEMultiHitTargetDataHitsSent, NumHits);
+	}
+
+	bOutSuccess = true;
+
+	for (FPECompactHitData& Hit : Hits)
+	{
+		bool bHitSuccess = true;
+		Hit.NetSerialize(Ar, Map, bHitSuccess);
+
+		bOutSuccess &= bHitSuccess;
+	}
+
+	return true;
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand PETargetDataBenchmarkCommand(
+	TEXT("PE.TargetData.Benchmark"),
+	TEXT("Compare the allocations, build time and serialized size of N hits using a single target hit per hit and using the multi hit target data. Object references are not included in the sizes. Usage: PE.TargetData.Benchmark [N=32]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumHits = Args.IsEmpty() ? 32 : FMath::Clamp(FCString::Atoi(*Args[0]), 1, static_cast<int32>(MultiHitMaxNetSerializedHits));
+
+		// Fixed seed: Results are comparable between runs
+		FRandomStream RandomStream(42);
+
+		TArray<FHitResult> HitResults;
+		HitResults.Reserve(NumHits);
+
+		for (int32 Iterator = 0; Iterator < NumHits; ++Iterator)
+		{
+			const FVector Start = RandomStream.VRand() * 1000.f;
+			const FVector End = Start + RandomStream.VRand() * 1000.f;
+
+			FHitResult& HitResult = HitResults.Emplace_GetRef(static_cast<AActor*>(nullptr), nullptr, FMath::Lerp(Start, End, 0.5f), RandomStream.VRand());
+			HitResult.TraceStart = Start;
+			HitResult.TraceEnd = End;
+			HitResult.bBlockingHit = true;
+			HitResult.Distance = FVector::Dist(Start, HitResult.ImpactPoint);
+			HitResult.Time = 0.5f;
+		}
+
+		// Single target hits: An allocation and a full hit result per hit
+		const double SingleStartTime = FPlatformTime::Seconds();
+
+		FGameplayAbilityTargetDataHandle SingleHandle;
+		for (const FHitResult& HitResult : HitResults)
+		{
+			SingleHandle.Add(new FGameplayAbilityTargetData_SingleTargetHit(HitResult));
+		}
+
+		const double SingleTime = FPlatformTime::Seconds() - SingleStartTime;
+
+		FBitWriter SingleWriter(0, true);
+		for (int32 Iterator = 0; Iterator < SingleHandle.Num(); ++Iterator)
+		{
+			bool bSuccess = true;
+			static_cast<FGameplayAbilityTargetData_SingleTargetHit*>(SingleHandle.Get(Iterator))->NetSerialize(SingleWriter, nullptr, bSuccess);
+		}
+
+		// Multi hit: A single allocation and compact hits
+		const double MultiStartTime = FPlatformTime::Seconds();
+
+		const FGameplayAbilityTargetDataHandle MultiHandle(new FPEGameplayAbilityTargetData_MultiHit(HitResults));
+
+		const double MultiTime = FPlatformTime::Seconds() - MultiStartTime;
+
+		FBitWriter MultiWriter(0, true);
+		bool bSuccess = true;
+		static_cast<FPEGameplayAbilityTargetData_MultiHit*>(MultiHandle.Data[0].Get())->NetSerialize(MultiWriter, nullptr, bSuccess);
+
+		UE_LOG(LogTemp, Display, TEXT("%s - %d hits: Single target hits %d allocations, %.3f us, %lld bytes; Multi hit 1 allocation, %.3f us, %lld bytes"), *FString(__func__), NumHits, SingleHandle.Num(), SingleTime * 1000000.0, (SingleWriter.GetNumBits() + 7) / 8, MultiTime * 1000000.0, (MultiWriter.GetNumBits() + 7) / 8);
+	}));
+#endif
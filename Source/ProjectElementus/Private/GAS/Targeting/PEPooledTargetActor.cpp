@@ -0,0 +1,61 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/Targeting/PEPooledTargetActor.h"
+#include <Abilities/GameplayAbility.h>
+#include <Abilities/GameplayAbilityTargetActor.h>
+#include <Abilities/GameplayAbilityWorldReticle.h>
+
+void IPEPooledTargetActor::StartTargetingWithPooledReticle(AGameplayAbilityTargetActor* TargetActor, TWeakObjectPtr<AGameplayAbilityWorldReticle>& ReticleActor, UGameplayAbility* Ability, const TFunctionRef<void()> StartTargeting)
+{
+	// Pooled actors keep their reticle between activations: Reuse it instead of spawning a new one
+	AGameplayAbilityWorldReticle* const PooledReticle = ReticleActor.Get();
+	const TSubclassOf<AGameplayAbilityWorldReticle> RequestedReticleClass = TargetActor->ReticleClass;
+	const bool bReuseReticle = IsValid(PooledReticle) && PooledReticle->GetClass() == RequestedReticleClass;
+
+	if (IsValid(PooledReticle) && !bReuseReticle)
+	{
+		PooledReticle->Destroy();
+	}
+
+	ReticleActor.Reset();
+
+	// Without a reticle class, the parent implementation won't spawn a new reticle
+	if (bReuseReticle)
+	{
+		TargetActor->ReticleClass = nullptr;
+	}
+
+	StartTargeting();
+
+	if (bReuseReticle)
+	{
+		TargetActor->ReticleClass = RequestedReticleClass;
+		ReticleActor = PooledReticle;
+
+		PooledReticle->InitializeReticle(TargetActor, Ability->GetCurrentActorInfo()->PlayerController.Get(), TargetActor->ReticleParams);
+		PooledReticle->SetActorHiddenInGame(false);
+	}
+}
+
+void IPEPooledTargetActor::AcquireFromPool(AGameplayAbilityTargetActor* TargetActor)
+{
+	TargetActor->SetActorHiddenInGame(false);
+	TargetActor->SetActorTickEnabled(true);
+}
+
+void IPEPooledTargetActor::ReleaseToPool(AGameplayAbilityTargetActor* TargetActor, const TWeakObjectPtr<AGameplayAbilityWorldReticle>& ReticleActor)
+{
+	TargetActor->SetActorTickEnabled(false);
+	TargetActor->SetActorHiddenInGame(true);
+
+	if (AGameplayAbilityWorldReticle* const PooledReticle = ReticleActor.Get())
+	{
+		PooledReticle->SetActorHiddenInGame(true);
+	}
+
+	TargetActor->OwningAbility = nullptr;
+	TargetActor->SourceActor = nullptr;
+	TargetActor->bDestroyOnConfirmation = false;
+}
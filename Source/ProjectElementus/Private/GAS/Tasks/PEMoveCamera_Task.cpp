@@ -4,21 +4,21 @@
 
 #include "GAS/Tasks/PEMoveCamera_Task.h"
 #include "Actors/Character/PECharacter.h"
-#include <Components/TimelineComponent.h>
-#include <Camera/CameraComponent.h>
+#include "Components/PECameraOffsetComponent.h"
 
 UPEMoveCamera_Task::UPEMoveCamera_Task(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	bTickingTask = false;
 }
 
-UPEMoveCamera_Task* UPEMoveCamera_Task::MoveCamera(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const FVector CameraRelativeTargetPosition, const float CameraLerpTime, const bool bAdjustTimeToCurrentLocation)
+UPEMoveCamera_Task* UPEMoveCamera_Task::MoveCamera(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const FVector CameraRelativeTargetPosition, const float CameraLerpTime, const bool bAdjustTimeToCurrentLocation, const int32 Priority)
 {
-	UPEMoveCamera_Task* const MyObj = NewAbilityTask<UPEMoveCamera_Task>(OwningAbility, TaskInstanceName);	
+	UPEMoveCamera_Task* const MyObj = NewAbilityTask<UPEMoveCamera_Task>(OwningAbility, TaskInstanceName);
 	MyObj->CameraTargetPosition = CameraRelativeTargetPosition;
 	MyObj->CameraLerpTime = CameraLerpTime;
 	MyObj->bAdjustTimeToCurrentLocation = bAdjustTimeToCurrentLocation;
-	
+	MyObj->Priority = Priority;
+
 	return MyObj;
 }
 
@@ -28,109 +28,85 @@ void UPEMoveCamera_Task::Activate()
 
 	check(Ability);
 
-	TaskTimeline = NewObject<UTimelineComponent>(GetAvatarActor(), UTimelineComponent::StaticClass(), TEXT("MoveCameraTimeline"));
-	if (!TaskTimeline.IsValid())
-	{
-		UE_LOG(LogGameplayTasks, Error, TEXT("%s - Task %s ended on activation due to invalid timeline"), *FString(__func__), *GetName());
+	const APECharacter* const OwningCharacter = Cast<APECharacter>(Ability->GetAvatarActorFromActorInfo());
 
+	if (!ensureAlwaysMsgf(IsValid(OwningCharacter), TEXT("%s - Task %s failed to activate because have a invalid owner"), *FString(__func__), *GetName()))
+	{
 		EndTask();
 		return;
 	}
 
-	APECharacter* const OwningCharacter = Cast<APECharacter>(Ability->GetAvatarActorFromActorInfo());
+	CameraOffset = OwningCharacter->GetCameraOffset();
 
-	if (ensureAlwaysMsgf(IsValid(OwningCharacter), TEXT("%s - Task %s failed to activate because have a invalid owner"), *FString(__func__), *GetName()))
+	if (!CameraOffset.IsValid())
 	{
-		TargetCamera = OwningCharacter->GetFollowCamera();
-		CameraInitialPosition = TargetCamera->GetRelativeLocation();
+		UE_LOG(LogGameplayTasks, Error, TEXT("%s - Task %s ended on activation due to invalid camera offset component"), *FString(__func__), *GetName());
 
-		if (!TargetCamera.IsValid())
-		{
-			UE_LOG(LogGameplayTasks, Error, TEXT("%s - Task %s ended on activation due to invalid camera target"), *FString(__func__), *GetName());
-			
-			EndTask();
-		}
+		OnFailed.Broadcast();
+		EndTask();
 
-		if (bAdjustTimeToCurrentLocation)
+		return;
+	}
+
+	if (bAdjustTimeToCurrentLocation)
+	{
+		const double Distance1 = FVector::Distance(CameraOffset->GetCurrentLocation(), CameraTargetPosition);
+		const double Distance2 = FVector::Distance(CameraOffset->GetBaseLocation(), CameraTargetPosition);
+
+		if (Distance2 > UE_KINDA_SMALL_NUMBER)
 		{
-			const float Distance1 = FVector::Distance(CameraInitialPosition, CameraTargetPosition);
-			const float Distance2 = FVector::Distance(APECharacter::GetCameraDefaultPosition(), CameraTargetPosition);
-			CameraLerpTime *= (Distance1 / Distance2);
+			CameraLerpTime *= static_cast<float>(Distance1 / Distance2);
 		}
-		
-		TaskTimeline->SetTimelineLength(CameraLerpTime);
-
-		UCurveFloat* const TimelineCurve = NewObject<UCurveFloat>();
-		TimelineCurve->FloatCurve.AddKey(0.f, 0.f);
-		TimelineCurve->FloatCurve.AddKey(CameraLerpTime, 1.f);
-
-		FOnTimelineFloat TimelineUpdate;
-		TimelineUpdate.BindUFunction(this, TEXT("TimelineProgress"));
-		TaskTimeline->AddInterpFloat(TimelineCurve, TimelineUpdate);
-		
-		FOnTimelineEvent TimelineFinished;
-		TimelineFinished.BindUFunction(this, TEXT("TimelineFinished"));
-		TaskTimeline->SetTimelineFinishedFunc(TimelineFinished);
-		
-		TaskTimeline->RegisterComponentWithWorld(GetWorld());
-		TaskTimeline->Play();
+	}
+
+	RequestHandle = CameraOffset->AddOffsetRequest(CameraTargetPosition, CameraLerpTime, Priority, FPECameraOffsetBlendFinished::CreateUObject(this, &UPEMoveCamera_Task::BlendFinished));
+
+	if (RequestHandle == INDEX_NONE)
+	{
+		UE_LOG(LogGameplayTasks, Error, TEXT("%s - Task %s ended on activation due to invalid camera target"), *FString(__func__), *GetName());
+
+		OnFailed.Broadcast();
+		EndTask();
 	}
 }
 
 void UPEMoveCamera_Task::RevertCameraPosition()
 {
-	if (!TaskTimeline.IsValid())
+	if (!CameraOffset.IsValid() || !CameraOffset->RevertOffsetRequest(RequestHandle))
 	{
-		UE_LOG(LogGameplayTasks, Error, TEXT("%s - Task %s failed while trying to revert camera position due to invalid timeline"), *FString(__func__), *GetName());
-		
+		UE_LOG(LogGameplayTasks, Error, TEXT("%s - Task %s failed while trying to revert camera position due to invalid camera offset request"), *FString(__func__), *GetName());
+
 		OnFailed.Broadcast();
 		EndTask();
-
-		return;
 	}
-	
-	TaskTimeline->Reverse();
 }
 
 void UPEMoveCamera_Task::OnDestroy(const bool AbilityIsEnding)
 {
 	UE_LOG(LogGameplayTasks, Display, TEXT("%s - Task %s ended"), *FString(__func__), *GetName());
 
-	if (TaskTimeline.IsValid() && TaskTimeline->IsPlaying())
+	// Requests left by the task blend back on their own
+	if (CameraOffset.IsValid() && CameraOffset->IsValidOffsetRequest(RequestHandle))
 	{
-		UE_LOG(LogGameplayTasks, Warning, TEXT("%s - Task %s ended while the timeline is playing!"), *FString(__func__), *GetName());
-	}
-
-	Super::OnDestroy(AbilityIsEnding);
-}
+		UE_LOG(LogGameplayTasks, Warning, TEXT("%s - Task %s ended while the camera is moved: Reverting it"), *FString(__func__), *GetName());
 
-void UPEMoveCamera_Task::TimelineProgress(const float InValue)
-{
-	CurrentValue = InValue;
-	
-	if (!TargetCamera.IsValid())
-	{
-		UE_LOG(LogGameplayTasks, Error, TEXT("%s - Task %s failed while trying to change camera position due to invalid target camera"), *FString(__func__), *GetName());
-		
-		OnFailed.Broadcast();
-		
-		TaskTimeline->Stop();
-		EndTask();
-		
-		return;
+		CameraOffset->ReleaseOffsetRequest(RequestHandle);
 	}
 
-	TargetCamera->SetRelativeLocation(FMath::Lerp(CameraInitialPosition, CameraTargetPosition, InValue));
+	RequestHandle = INDEX_NONE;
+
+	Super::OnDestroy(AbilityIsEnding);
 }
 
-void UPEMoveCamera_Task::TimelineFinished()
+void UPEMoveCamera_Task::BlendFinished(const bool bReverted)
 {
-	if (CurrentValue == 0.f)
+	if (bReverted)
 	{
+		RequestHandle = INDEX_NONE;
 		OnReversionCompleted.Broadcast();
 	}
-	else if (CurrentValue == CameraLerpTime)
+	else
 	{
-		OnMoveCompleted.Broadcast();		
-	}	
+		OnMoveCompleted.Broadcast();
+	}
 }
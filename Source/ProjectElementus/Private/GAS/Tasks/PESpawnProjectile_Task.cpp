@@ -11,7 +11,7 @@ UPESpawnProjectile_Task::UPESpawnProjectile_Task(const FObjectInitializer& Objec
 	bTickingTask = false;
 }
 
-UPESpawnProjectile_Task* UPESpawnProjectile_Task::SpawnProjectile(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const TSubclassOf<APEProjectileActor> ClassToSpawn, const FTransform SpawnTransform, const FVector DirectionToFire, const TArray<FGameplayEffectGroupedData> EffectDataArray)
+UPESpawnProjectile_Task* UPESpawnProjectile_Task::SpawnProjectile(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const TSubclassOf<APEProjectileActor> ClassToSpawn, const FTransform SpawnTransform, const FVector DirectionToFire, const TArray<FGameplayEffectGroupedData>& EffectDataArray)
 {
 	UPESpawnProjectile_Task* const MyObj = NewAbilityTask<UPESpawnProjectile_Task>(OwningAbility, TaskInstanceName);
 	MyObj->ProjectileClass = ClassToSpawn;
@@ -38,7 +38,8 @@ void UPESpawnProjectile_Task::Activate()
 	{
 		APEProjectileActor* const SpawnedProjectile = GetWorld()->SpawnActorDeferred<APEProjectileActor>(ProjectileClass, ProjectileTransform, GetOwnerActor(), nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
 
-		SpawnedProjectile->ProjectileEffects = ProjectileEffectArr;
+		// The task ends after spawning: move the effects instead of copying them
+		SpawnedProjectile->ProjectileEffects = MoveTemp(ProjectileEffectArr);
 		SpawnedProjectile->FinishSpawning(ProjectileTransform);
 
 		if (IsValid(SpawnedProjectile))
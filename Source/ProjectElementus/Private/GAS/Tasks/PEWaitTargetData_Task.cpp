@@ -0,0 +1,131 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "GAS/Tasks/PEWaitTargetData_Task.h"
+#include "GAS/System/PEAbilitySystemComponent.h"
+#include "Management/ProjectElementus.h"
+#include <Abilities/GameplayAbilityTargetActor.h>
+#include <HAL/IConsoleManager.h>
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Actors Spawned"), STAT_PETargetingActorsSpawned, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Targeting Actors Reused"), STAT_PETargetingActorsReused, STATGROUP_ProjectElementus);
+
+namespace TargetActorPool
+{
+	/* Totals since the last reset, reported by PE.Targeting.DumpPoolStats */
+	uint64 NumSpawned = 0u;
+	uint64 NumReused = 0u;
+	double StatsStartTime = 0.0;
+}
+
+UPEWaitTargetData_Task* UPEWaitTargetData_Task::WaitPooledTargetData(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const TEnumAsByte<EGameplayTargetingConfirmation::Type> ConfirmationType, const TSubclassOf<AGameplayAbilityTargetActor> InTargetClass)
+{
+	UPEWaitTargetData_Task* const MyObj = NewAbilityTask<UPEWaitTargetData_Task>(OwningAbility, TaskInstanceName);
+	MyObj->TargetClass = InTargetClass;
+	MyObj->TargetActor = nullptr;
+	MyObj->ConfirmationType = ConfirmationType;
+
+	return MyObj;
+}
+
+bool UPEWaitTargetData_Task::BeginSpawningPooledActor(UGameplayAbility* OwningAbility, const TSubclassOf<AGameplayAbilityTargetActor> InTargetClass, AGameplayAbilityTargetActor*& SpawnedActor)
+{
+	SpawnedActor = nullptr;
+	bIsPooledActor = false;
+
+	if (TargetActorPool::StatsStartTime == 0.0)
+	{
+		TargetActorPool::StatsStartTime = FPlatformTime::Seconds();
+	}
+
+	if (UPEAbilitySystemComponent* const PoolOwner = Cast<UPEAbilitySystemComponent>(AbilitySystemComponent.Get());
+		IsValid(PoolOwner) && Ability && ShouldSpawnTargetActor())
+	{
+		if (AGameplayAbilityTargetActor* const PooledActor = PoolOwner->AcquirePooledTargetActor(InTargetClass.Get()))
+		{
+			SpawnedActor = PooledActor;
+			TargetActor = PooledActor;
+			bIsPooledActor = true;
+
+			InitializeTargetActor(PooledActor);
+			RegisterTargetDataCallbacks();
+
+			INC_DWORD_STAT(STAT_PETargetingActorsReused);
+			++TargetActorPool::NumReused;
+
+			return true;
+		}
+	}
+
+	const bool bSpawned = BeginSpawningActor(OwningAbility, InTargetClass, SpawnedActor);
+
+	if (bSpawned)
+	{
+		INC_DWORD_STAT(STAT_PETargetingActorsSpawned);
+		++TargetActorPool::NumSpawned;
+	}
+
+	return bSpawned;
+}
+
+void UPEWaitTargetData_Task::FinishSpawningPooledActor(UGameplayAbility* OwningAbility, AGameplayAbilityTargetActor* SpawnedActor)
+{
+	if (!bIsPooledActor)
+	{
+		FinishSpawningActor(OwningAbility, SpawnedActor);
+		return;
+	}
+
+	if (IsValid(SpawnedActor))
+	{
+		check(TargetActor == SpawnedActor);
+
+		// Same transform used by FinishSpawningActor for new actors
+		SpawnedActor->SetActorTransform(AbilitySystemComponent->GetOwner()->GetTransform());
+		FinalizeTargetActor(SpawnedActor);
+	}
+}
+
+void UPEWaitTargetData_Task::OnDestroy(const bool AbilityEnded)
+{
+	// Park the actor instead of letting the parent task destroy it
+	if (AGameplayAbilityTargetActor* const FinishedActor = TargetActor.Get();
+		IsValid(FinishedActor))
+	{
+		FinishedActor->TargetDataReadyDelegate.RemoveAll(this);
+		FinishedActor->CanceledDelegate.RemoveAll(this);
+
+		if (UPEAbilitySystemComponent* const PoolOwner = Cast<UPEAbilitySystemComponent>(AbilitySystemComponent.Get());
+			IsValid(PoolOwner) && PoolOwner->ReleasePooledTargetActor(FinishedActor))
+		{
+			TargetActor = nullptr;
+		}
+	}
+
+	Super::OnDestroy(AbilityEnded);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithOutputDevice PETargetingDumpPoolStatsCommand(
+	TEXT("PE.Targeting.DumpPoolStats"),
+	TEXT("Print the targeting actors spawned and reused by the wait target data tasks, in total and per minute since the last reset"),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+	{
+		const double ElapsedMinutes = TargetActorPool::StatsStartTime > 0.0 ? (FPlatformTime::Seconds() - TargetActorPool::StatsStartTime) / 60.0 : 0.0;
+		const double SpawnedPerMinute = ElapsedMinutes > 0.0 ? static_cast<double>(TargetActorPool::NumSpawned) / ElapsedMinutes : 0.0;
+		const double ReusedPerMinute = ElapsedMinutes > 0.0 ? static_cast<double>(TargetActorPool::NumReused) / ElapsedMinutes : 0.0;
+
+		Ar.Logf(TEXT("Targeting actors in %.2f minutes: %llu spawned (%.1f/min), %llu reused (%.1f/min)"), ElapsedMinutes, TargetActorPool::NumSpawned, SpawnedPerMinute, TargetActorPool::NumReused, ReusedPerMinute);
+	}));
+
+static FAutoConsoleCommand PETargetingResetPoolStatsCommand(
+	TEXT("PE.Targeting.ResetPoolStats"),
+	TEXT("Clear the targeting actor spawn and reuse totals"),
+	FConsoleCommandDelegate::CreateLambda([]
+	{
+		TargetActorPool::NumSpawned = 0u;
+		TargetActorPool::NumReused = 0u;
+		TargetActorPool::StatsStartTime = FPlatformTime::Seconds();
+	}));
+#endif
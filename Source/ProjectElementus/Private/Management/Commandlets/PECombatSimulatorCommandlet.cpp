@@ -0,0 +1,364 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "Management/Commandlets/PECombatSimulatorCommandlet.h"
+#include "Actors/Interfaces/PEEquipment.h"
+#include "GAS/Effects/PEDamageGEC.h"
+#include "GAS/Attributes/PECustomStatusAS.h"
+#include "GAS/Attributes/PELevelingAS.h"
+#include <GameplayEffect.h>
+#include <Async/ParallelFor.h>
+#include <Misc/FileHelper.h>
+#include <Misc/Paths.h>
+
+DEFINE_LOG_CATEGORY_STATIC(LogCombatSimulator, Display, All);
+
+/* Limits of the simulation grid: Results and the CSV output are kept in memory */
+constexpr int32 MaxSimulatedLevel = 100;
+constexpr int32 MaxSimulatedRateSteps = 100;
+constexpr int64 MaxSimulationCells = 1 << 24;
+
+/* Modifiers of a single attribute, evaluated like FAggregatorModChannel::EvaluateWithBase: ((Base + Additive) * Multiplicitive) / Division */
+struct FPESimulatedModifiers
+{
+	float Additive = 0.f;
+
+	/* Multipliers and divisors are summed as biases from 1: Two 1.5 multipliers result in 2, not 2.25 */
+	float Multiplicitive = 1.f;
+	float Division = 1.f;
+
+	float Evaluate(const float InBaseValue) const
+	{
+		return (InBaseValue + Additive) * Multiplicitive / (FMath::IsNearlyZero(Division) ? 1.f : Division);
+	}
+};
+
+/* Attack and defense rate modifiers granted by a equipment */
+struct FPESimulatedEquipment
+{
+	FString Name = TEXT("None");
+
+	FPESimulatedModifiers AttackRate;
+	FPESimulatedModifiers DefenseRate;
+
+	float ApplyToAttackRate(const float InValue) const
+	{
+		return AttackRate.Evaluate(InValue);
+	}
+
+	float ApplyToDefenseRate(const float InValue) const
+	{
+		return DefenseRate.Evaluate(InValue);
+	}
+};
+
+/* Position of a matchup in the simulation grid */
+struct FPESimulationCell
+{
+	FPESimulationCell(int32 CellIndex, const int32 NumLevels, const int32 NumEquipments, const int32 NumRates)
+	{
+		DefenseRateIndex = CellIndex % NumRates;
+		CellIndex /= NumRates;
+
+		AttackRateIndex = CellIndex % NumRates;
+		CellIndex /= NumRates;
+
+		DefenderEquipmentIndex = CellIndex % NumEquipments;
+		CellIndex /= NumEquipments;
+
+		AttackerEquipmentIndex = CellIndex % NumEquipments;
+		CellIndex /= NumEquipments;
+
+		DefenderLevel = CellIndex % NumLevels;
+		AttackerLevel = CellIndex / NumLevels;
+	}
+
+	int32 AttackerLevel;
+	int32 DefenderLevel;
+	int32 AttackerEquipmentIndex;
+	int32 DefenderEquipmentIndex;
+	int32 AttackRateIndex;
+	int32 DefenseRateIndex;
+};
+
+struct FPESimulationResult
+{
+	float AttackRate = 0.f;
+	float DefenseRate = 0.f;
+	float MinDamage = 0.f;
+	float MeanDamage = 0.f;
+	float MaxDamage = 0.f;
+};
+
+static void AccumulateModifier(const EGameplayModOp::Type ModifierOp, const float Magnitude, FPESimulatedModifiers& OutModifiers)
+{
+	// Same bias used by FAggregatorModChannel::SumMods
+	switch (ModifierOp)
+	{
+		case EGameplayModOp::Additive:
+			OutModifiers.Additive += Magnitude;
+			break;
+
+		case EGameplayModOp::Multiplicitive:
+			OutModifiers.Multiplicitive += Magnitude - 1.f;
+			break;
+
+		case EGameplayModOp::Division:
+			OutModifiers.Division += Magnitude - 1.f;
+			break;
+
+		default:
+			break;
+	}
+}
+
+static bool LoadSimulatedEquipment(const FString& ClassPath, FPESimulatedEquipment& OutEquipment)
+{
+	const UClass* const EquipmentClass = LoadClass<UPEEquipment>(nullptr, *ClassPath);
+	if (!IsValid(EquipmentClass))
+	{
+		UE_LOG(LogCombatSimulator, Error, TEXT("%s - Failed to load equipment class %s"), *FString(__func__), *ClassPath);
+		return false;
+	}
+
+	OutEquipment.Name = EquipmentClass->GetName();
+
+	for (const FGameplayEffectGroupedData& EffectData : EquipmentClass->GetDefaultObject<UPEEquipment>()->EquipmentEffects)
+	{
+		const UGameplayEffect* const Effect = IsValid(EffectData.EffectClass) ? EffectData.EffectClass->GetDefaultObject<UGameplayEffect>() : nullptr;
+		if (!IsValid(Effect))
+		{
+			continue;
+		}
+
+		for (const FGameplayModifierInfo& Modifier : Effect->Modifiers)
+		{
+			float Magnitude = 0.f;
+
+			// Equipment uses the same Set by Caller parameters that are applied at runtime by the ability system component
+			if (Modifier.ModifierMagnitude.GetMagnitudeCalculationType() == EGameplayEffectMagnitudeCalculation::SetByCaller)
+			{
+				const FGameplayTag DataTag = Modifier.ModifierMagnitude.GetSetByCallerFloat().DataTag;
+				const TPair<FGameplayTag, float>* const SetByCaller = EffectData.GetSetByCallerData().FindByPredicate([&DataTag](const TPair<FGameplayTag, float>& Iterator)
+				{
+					return Iterator.Key == DataTag;
+				});
+
+				if (!SetByCaller)
+				{
+					continue;
+				}
+
+				Magnitude = SetByCaller->Value;
+			}
+			else if (!Modifier.ModifierMagnitude.GetStaticMagnitudeIfPossible(1.f, Magnitude))
+			{
+				UE_LOG(LogCombatSimulator, Warning, TEXT("%s - Skipping non static modifier of effect %s"), *FString(__func__), *Effect->GetName());
+				continue;
+			}
+
+			if (Modifier.Attribute == UPECustomStatusAS::GetAttackRateAttribute())
+			{
+				AccumulateModifier(Modifier.ModifierOp, Magnitude, OutEquipment.AttackRate);
+			}
+			else if (Modifier.Attribute == UPECustomStatusAS::GetDefenseRateAttribute())
+			{
+				AccumulateModifier(Modifier.ModifierOp, Magnitude, OutEquipment.DefenseRate);
+			}
+		}
+	}
+
+	return true;
+}
+
+UPECombatSimulatorCommandlet::UPECombatSimulatorCommandlet(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UPECombatSimulatorCommandlet::Main(const FString& Params)
+{
+	FString OutputPath = FPaths::ProjectSavedDir() / TEXT("CombatSimulation.csv");
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FString LevelingTablePath = TEXT("/Game/Main/Data/GAS/AttributeMetaDatas/DT_LevelingBonus");
+	FParse::Value(*Params, TEXT("LevelingTable="), LevelingTablePath);
+
+	int32 MaxLevel = 10;
+	FParse::Value(*Params, TEXT("MaxLevel="), MaxLevel);
+	MaxLevel = FMath::Clamp(MaxLevel, 0, MaxSimulatedLevel);
+
+	int32 Samples = 1000;
+	FParse::Value(*Params, TEXT("Samples="), Samples);
+	Samples = FMath::Max(Samples, 1);
+
+	int32 RateSteps = 10;
+	FParse::Value(*Params, TEXT("RateSteps="), RateSteps);
+	RateSteps = FMath::Clamp(RateSteps, 1, MaxSimulatedRateSteps);
+
+	float BaseDamage = 10.f;
+	FParse::Value(*Params, TEXT("BaseDamage="), BaseDamage);
+
+	float MinRate = 0.5f;
+	FParse::Value(*Params, TEXT("MinRate="), MinRate);
+
+	float MaxRate = 5.f;
+	FParse::Value(*Params, TEXT("MaxRate="), MaxRate);
+
+	int32 Seed = 0;
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+
+	// Cumulative leveling bonus: The level N have the sum of the rows 1 to N, as applied by UPELevelingAS on each level up
+	TArray<float> LevelAttackBonus;
+	LevelAttackBonus.Init(0.f, MaxLevel + 1);
+
+	TArray<float> LevelDefenseBonus;
+	LevelDefenseBonus.Init(0.f, MaxLevel + 1);
+
+	if (const UDataTable* const LevelingTable = LoadObject<UDataTable>(nullptr, *LevelingTablePath))
+	{
+		TArray<FPELevelingData> LevelingRows;
+		UPELevelingAS::BuildLevelingTable(LevelingTable, LevelingRows);
+
+		for (int32 Level = 1; Level <= MaxLevel; ++Level)
+		{
+			LevelAttackBonus[Level] = LevelAttackBonus[Level - 1];
+			LevelDefenseBonus[Level] = LevelDefenseBonus[Level - 1];
+
+			if (LevelingRows.IsValidIndex(Level))
+			{
+				LevelAttackBonus[Level] += LevelingRows[Level].BonusAttackRate;
+				LevelDefenseBonus[Level] += LevelingRows[Level].BonusDefenseRate;
+			}
+		}
+	}
+	else
+	{
+		UE_LOG(LogCombatSimulator, Warning, TEXT("%s - Failed to load leveling table %s: Simulating without leveling bonus"), *FString(__func__), *LevelingTablePath);
+	}
+
+	TArray<FPESimulatedEquipment> Equipments;
+	Equipments.AddDefaulted();
+
+	FString EquipmentParam;
+	if (FParse::Value(*Params, TEXT("Equipment="), EquipmentParam, false))
+	{
+		TArray<FString> EquipmentPaths;
+		EquipmentParam.ParseIntoArray(EquipmentPaths, TEXT(","));
+
+		for (const FString& Iterator : EquipmentPaths)
+		{
+			if (FPESimulatedEquipment Equipment; LoadSimulatedEquipment(Iterator, Equipment))
+			{
+				Equipments.Add(MoveTemp(Equipment));
+			}
+		}
+	}
+
+	TArray<float> Rates;
+	for (int32 Step = 0; Step <= RateSteps; ++Step)
+	{
+		Rates.Add(FMath::Lerp(MinRate, MaxRate, static_cast<float>(Step) / RateSteps));
+	}
+
+	// Grid: attacker level x defender level x attacker equipment x defender equipment x attack rate x defense rate
+	const int32 NumLevels = MaxLevel + 1;
+	const int32 NumEquipments = Equipments.Num();
+	const int32 NumRates = Rates.Num();
+	const int64 NumCells64 = static_cast<int64>(NumLevels) * NumLevels * NumEquipments * NumEquipments * NumRates * NumRates;
+
+	if (NumCells64 > MaxSimulationCells)
+	{
+		UE_LOG(LogCombatSimulator, Error, TEXT("%s - The grid has %lld matchups, more than the limit of %lld: Reduce MaxLevel, RateSteps or the number of equipments"), *FString(__func__), NumCells64, MaxSimulationCells);
+		return 1;
+	}
+
+	const int32 NumCells = static_cast<int32>(NumCells64);
+
+	UE_LOG(LogCombatSimulator, Display, TEXT("%s - Simulating %d matchups with %d samples each"), *FString(__func__), NumCells, Samples);
+
+	TArray<FPESimulationResult> Results;
+	Results.SetNum(NumCells);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	ParallelFor(NumCells, [&](const int32 CellIndex)
+	{
+		const FPESimulationCell Cell(CellIndex, NumLevels, NumEquipments, NumRates);
+
+		// Same clamps used by the damage execution
+		const float AttackRate = FMath::Max(Equipments[Cell.AttackerEquipmentIndex].ApplyToAttackRate(Rates[Cell.AttackRateIndex] + LevelAttackBonus[Cell.AttackerLevel]), 0.f);
+		const float DefenseRate = FMath::Max(Equipments[Cell.DefenderEquipmentIndex].ApplyToDefenseRate(Rates[Cell.DefenseRateIndex] + LevelDefenseBonus[Cell.DefenderLevel]), 0.f);
+
+		TArray<float> BaseDamageArr;
+		BaseDamageArr.Init(FMath::Max(BaseDamage, 0.f), Samples);
+
+		TArray<float> AttackRateArr;
+		AttackRateArr.Init(AttackRate, Samples);
+
+		TArray<float> DefenseRateArr;
+		DefenseRateArr.Init(DefenseRate, Samples);
+
+		// Each sample stands for a separate application: Own seed, derived from the cell seed
+		const uint32 CellSeed = HashCombine(static_cast<uint32>(Seed), static_cast<uint32>(CellIndex));
+
+		TArray<int32> SeedArr;
+		SeedArr.SetNumUninitialized(Samples);
+
+		for (int32 SampleIndex = 0; SampleIndex < Samples; ++SampleIndex)
+		{
+			SeedArr[SampleIndex] = static_cast<int32>(HashCombine(CellSeed, static_cast<uint32>(SampleIndex)));
+		}
+
+		TArray<float> DamageArr;
+		DamageArr.SetNumUninitialized(Samples);
+
+		UPEDamageGEC::CalculateDamageBatch(BaseDamageArr, AttackRateArr, DefenseRateArr, SeedArr, DamageArr);
+
+		FPESimulationResult& Result = Results[CellIndex];
+		Result.AttackRate = AttackRate;
+		Result.DefenseRate = DefenseRate;
+		Result.MinDamage = FMath::Min(DamageArr);
+		Result.MaxDamage = FMath::Max(DamageArr);
+
+		double DamageSum = 0.0;
+		for (const float Damage : DamageArr)
+		{
+			DamageSum += Damage;
+		}
+
+		Result.MeanDamage = static_cast<float>(DamageSum / Samples);
+	});
+
+	const double ElapsedTime = FMath::Max(FPlatformTime::Seconds() - StartTime, UE_DOUBLE_SMALL_NUMBER);
+	const double NumEvaluations = static_cast<double>(NumCells) * Samples;
+
+	UE_LOG(LogCombatSimulator, Display, TEXT("%s - %.0f evaluations in %.3f seconds: %.0f evaluations per second"), *FString(__func__), NumEvaluations, ElapsedTime, NumEvaluations / ElapsedTime);
+
+	FString Output = TEXT("AttackerLevel,DefenderLevel,AttackerEquipment,DefenderEquipment,FinalAttackRate,FinalDefenseRate,BaseDamage,MinDamage,MeanDamage,MaxDamage\n");
+	Output.Reserve(static_cast<int32>(FMath::Min<int64>(NumCells64 * 96, MAX_int32)));
+
+	for (int32 CellIndex = 0; CellIndex < NumCells; ++CellIndex)
+	{
+		const FPESimulationCell Cell(CellIndex, NumLevels, NumEquipments, NumRates);
+
+		const FPESimulationResult& Result = Results[CellIndex];
+
+		Output += FString::Printf(TEXT("%d,%d,%s,%s,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n"),
+		                          Cell.AttackerLevel, Cell.DefenderLevel, *Equipments[Cell.AttackerEquipmentIndex].Name, *Equipments[Cell.DefenderEquipmentIndex].Name,
+		                          Result.AttackRate, Result.DefenseRate, BaseDamage, Result.MinDamage, Result.MeanDamage, Result.MaxDamage);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Output, *OutputPath))
+	{
+		UE_LOG(LogCombatSimulator, Error, TEXT("%s - Failed to write the results to %s"), *FString(__func__), *OutputPath);
+		return 1;
+	}
+
+	UE_LOG(LogCombatSimulator, Display, TEXT("%s - Results written to %s"), *FString(__func__), *OutputPath);
+	return 0;
+}
@@ -0,0 +1,88 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "Management/Data/PEGlobalTags.h"
+
+#pragma region Generic
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_GenericCooldown, "GameplayEffect.Cooldown");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_PlayerData, "Data.Game.Player");
+#pragma endregion Generic
+
+#pragma region SetByCaller
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerDuration, "SetByCaller.Duration");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerHealth, "SetByCaller.Health");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerStamina, "SetByCaller.Stamina");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerMana, "SetByCaller.Mana");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerFloat1, "SetByCaller.Float1");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerFloat2, "SetByCaller.Float2");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerFloat3, "SetByCaller.Float3");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerFloat4, "SetByCaller.Float4");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_SetByCallerFloat5, "SetByCaller.Float5");
+#pragma endregion SetByCaller
+
+#pragma region Equipment
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_EquipSlot_Base, "EquipSlot");
+
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_WeaponSlot_Base, "EquipSlot.Weapon");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_WeaponSlot_Both, "EquipSlot.Weapon.Both");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_WeaponSlot_Left, "EquipSlot.Weapon.Left");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_WeaponSlot_Right, "EquipSlot.Weapon.Right");
+#pragma endregion Equipment
+
+#pragma region Effect
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Damage, "Data.Damage");
+#pragma endregion Effect
+
+#pragma region State
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_CanInteract, "State.CanInteract");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_CannotInteract, "State.CannotInteract");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_DeadState, "State.Dead");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_StunState, "State.Stunned");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AimingState, "State.Aiming");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AimingBlockedState, "State.Aiming.Blocked");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_WaitingConfirmationState, "State.WaitingConfirm");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_WaitingCancelationState, "State.WaitingCancel");
+#pragma endregion State
+
+#pragma region Attributes
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_RegenBlock_Health, "GameplayEffect.Debuff.Regeneration.Block.Health");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_RegenBlock_Mana, "GameplayEffect.Debuff.Regeneration.Block.Mana");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_RegenBlock_Stamina, "GameplayEffect.Debuff.Regeneration.Block.Stamina");
+
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_CostWhileActive_Stamina, "GameplayAbility.State.CostWhileActive.Stamina");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_CostWhileActive_Mana, "GameplayAbility.State.CostWhileActive.Mana");
+#pragma endregion Attributes
+
+#pragma region AbilityNotify
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AbilityNotify, "Data.Notify.Ability");
+#pragma endregion AbilityNotify
+
+#pragma region AbilityFailure
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AbilityFail_OnGive, "GameplayAbility.Fail.OnGive");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AbilityFail_TryActivate, "GameplayAbility.Fail.TryActivate");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AbilityFail_PreActivate, "GameplayAbility.Fail.PreActivate");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AbilityFail_CommitCheck, "GameplayAbility.Fail.CommitCheck");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AbilityFail_AuthorityOrPredictionKey, "GameplayAbility.Fail.HasAuthorityOrPredictionKey");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_AbilityFail_Cooldown, "GameplayAbility.Fail.Cooldown");
+#pragma endregion AbilityFailure
+
+#pragma region Abilities
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Crouch, "GameplayAbility.Default.Crouch");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Dash, "GameplayAbility.Default.Dash");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_DoubleJump, "GameplayAbility.Default.DoubleJump");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Interact, "GameplayAbility.Default.Interact");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Sprint, "GameplayAbility.Default.Sprint");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Walk, "GameplayAbility.Default.Walk");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Swinging, "GameplayAbility.Swinging");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Telekinesis, "GameplayAbility.Telekinesis");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Regeneration_Health, "GameplayAbility.Default.Regeneration.Health");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Regeneration_Mana, "GameplayAbility.Default.Regeneration.Mana");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Ability_Regeneration_Stamina, "GameplayAbility.Default.Regeneration.Stamina");
+#pragma endregion Abilities
+
+#pragma region GameplayCues
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Cue_DoubleJump, "GameplayCue.Default.DoubleJump");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Cue_Swinging, "GameplayCue.Swinging");
+UE_DEFINE_GAMEPLAY_TAG(GlobalTag_Cue_Telekinesis, "GameplayCue.Telekinesis");
+#pragma endregion GameplayCues
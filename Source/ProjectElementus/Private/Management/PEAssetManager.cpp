@@ -3,7 +3,12 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "Management/PEAssetManager.h"
+#include "Management/PEProjectSettings.h"
+#include "Management/ProjectElementus.h"
 #include <AbilitySystemGlobals.h>
+#include <Engine/StreamableManager.h>
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Project Settings Synchronous Loads"), STAT_PEProjectSettingsSyncLoads, STATGROUP_ProjectElementus);
 
 void UPEAssetManager::StartInitialLoading()
 {
@@ -11,4 +16,74 @@ void UPEAssetManager::StartInitialLoading()
 
 	// Should be called once as part of project setup to load global data tables and tags - From AbilitySystemGlobals.h
 	UAbilitySystemGlobals::Get().InitGlobalData();
+
+	PreloadProjectSettings();
+}
+
+UObject* UPEAssetManager::GetProjectSettingsObject(const FSoftObjectPath& InPath)
+{
+	if (InPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (const UPEAssetManager* const AssetManager = Cast<UPEAssetManager>(GEngine ? GEngine->AssetManager : nullptr))
+	{
+		if (const TObjectPtr<UObject>* const ResolvedObject = AssetManager->ResolvedProjectSettings.Find(InPath))
+		{
+			return *ResolvedObject;
+		}
+	}
+
+	// This is a hitch: The reference wasn't preloaded or the preload didn't finish yet
+	INC_DWORD_STAT(STAT_PEProjectSettingsSyncLoads);
+	UE_LOG(LogTemp, Warning, TEXT("%s - Synchronous load of %s: Project settings preload isn't complete"), *FString(__func__), *InPath.ToString());
+
+	return InPath.TryLoad();
+}
+
+TArray<FSoftObjectPath> UPEAssetManager::GetProjectSettingsReferences()
+{
+	TArray<FSoftObjectPath> References;
+
+	// Soft class properties are soft object properties too
+	const UPEProjectSettings* const ProjectSettings = GetDefault<UPEProjectSettings>();
+	for (TFieldIterator<FSoftObjectProperty> Iterator(UPEProjectSettings::StaticClass()); Iterator; ++Iterator)
+	{
+		if (const FSoftObjectPtr* const SoftObject = Iterator->GetPropertyValuePtr_InContainer(ProjectSettings);
+			SoftObject && !SoftObject->IsNull())
+		{
+			References.AddUnique(SoftObject->ToSoftObjectPath());
+		}
+	}
+
+	return References;
+}
+
+void UPEAssetManager::PreloadProjectSettings()
+{
+	const TArray<FSoftObjectPath> References = GetProjectSettingsReferences();
+	if (References.IsEmpty())
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("%s - Preloading %d project settings references"), *FString(__func__), References.Num());
+
+	// The handle is kept to hold the loaded objects for the whole session
+	ProjectSettingsHandle = GetStreamableManager().RequestAsyncLoad(References, FStreamableDelegate::CreateUObject(this, &UPEAssetManager::OnProjectSettingsLoaded), FStreamableManager::AsyncLoadHighPriority);
+}
+
+void UPEAssetManager::OnProjectSettingsLoaded()
+{
+	for (const FSoftObjectPath& Iterator : GetProjectSettingsReferences())
+	{
+		if (UObject* const LoadedObject = Iterator.ResolveObject())
+		{
+			ResolvedProjectSettings.Add(Iterator, LoadedObject);
+			continue;
+		}
+
+		UE_LOG(LogTemp, Error, TEXT("%s - Failed to preload %s"), *FString(__func__), *Iterator.ToString());
+	}
 }
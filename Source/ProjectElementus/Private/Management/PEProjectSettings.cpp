@@ -4,7 +4,7 @@
 
 #include "Management/PEProjectSettings.h"
 
-UPEProjectSettings::UPEProjectSettings(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), PlayerColor(FLinearColor::Blue), BotColor(FLinearColor::Red), GravityMultiplier(1.f), SpeedMultiplier(1.f), JumpMultiplier(1.f), AirControlMultiplier(1.f)
+UPEProjectSettings::UPEProjectSettings(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), PlayerColor(FLinearColor::Blue), BotColor(FLinearColor::Red), GravityMultiplier(1.f), SpeedMultiplier(1.f), JumpMultiplier(1.f), AirControlMultiplier(1.f), RegenerationInterval(0.25f), HealthRegenerationRate(0.f), StaminaRegenerationRate(0.f), ManaRegenerationRate(0.f), bQuantizedAttributeReplication(false)
 {
 	CategoryName = TEXT("Game");
 }
@@ -0,0 +1,387 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "Management/Subsystems/PEInteractableSubsystem.h"
+#include "Actors/Interfaces/PEInteractable.h"
+#include "Management/ProjectElementus.h"
+#include <Components/SceneComponent.h>
+#include <Engine/World.h>
+#include <HAL/IConsoleManager.h>
+
+DECLARE_CYCLE_STAT(TEXT("Interactable Registry Tick"), STAT_PEInteractableRegistryTick, STATGROUP_ProjectElementus);
+DECLARE_CYCLE_STAT(TEXT("Interactable Focus Query"), STAT_PEInteractableFocusQuery, STATGROUP_ProjectElementus);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Interactables"), STAT_PERegisteredInteractables, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interactable Focus Candidates"), STAT_PEInteractableFocusCandidates, STATGROUP_ProjectElementus);
+
+/* Cells with 4 meters: A default interaction range (10 meters) covers a few cells along the view direction */
+constexpr float InteractableCellSize = 400.f;
+
+/* Candidates checked for occlusion per focus query, from the closest to the view direction */
+constexpr int32 MaxFocusOcclusionTraces = 4;
+
+FPEInteractableSpatialHash::FPEInteractableSpatialHash(const float InCellSize) : CellSize(InCellSize)
+{
+}
+
+int32 FPEInteractableSpatialHash::Add(const FVector& InLocation)
+{
+	const int32 Index = FreeElements.IsEmpty() ? Elements.AddDefaulted() : FreeElements.Pop(false);
+
+	FElement& Element = Elements[Index];
+	Element.Location = InLocation;
+	Element.Cell = GetCell(InLocation);
+	Element.bInUse = true;
+
+	Cells.FindOrAdd(Element.Cell).Add(Index);
+	++NumElements;
+
+	return Index;
+}
+
+void FPEInteractableSpatialHash::Remove(const int32 InElement)
+{
+	if (!Elements.IsValidIndex(InElement) || !Elements[InElement].bInUse)
+	{
+		return;
+	}
+
+	FElement& Element = Elements[InElement];
+
+	if (TArray<int32>* const CellElements = Cells.Find(Element.Cell))
+	{
+		CellElements->RemoveSwap(InElement, false);
+
+		if (CellElements->IsEmpty())
+		{
+			Cells.Remove(Element.Cell);
+		}
+	}
+
+	Element.bInUse = false;
+	FreeElements.Add(InElement);
+	--NumElements;
+}
+
+void FPEInteractableSpatialHash::Update(const int32 InElement, const FVector& InLocation)
+{
+	if (!Elements.IsValidIndex(InElement) || !Elements[InElement].bInUse)
+	{
+		return;
+	}
+
+	FElement& Element = Elements[InElement];
+	Element.Location = InLocation;
+
+	const FIntVector NewCell = GetCell(InLocation);
+	if (NewCell == Element.Cell)
+	{
+		return;
+	}
+
+	if (TArray<int32>* const CellElements = Cells.Find(Element.Cell))
+	{
+		CellElements->RemoveSwap(InElement, false);
+
+		if (CellElements->IsEmpty())
+		{
+			Cells.Remove(Element.Cell);
+		}
+	}
+
+	Element.Cell = NewCell;
+	Cells.FindOrAdd(NewCell).Add(InElement);
+}
+
+const FVector& FPEInteractableSpatialHash::GetLocation(const int32 InElement) const
+{
+	return Elements[InElement].Location;
+}
+
+int32 FPEInteractableSpatialHash::Num() const
+{
+	return NumElements;
+}
+
+void FPEInteractableSpatialHash::QueryCone(const FVector& InOrigin, const FVector& InDirection, const float InRange, const float InMinDot, TArray<int32>& OutElements) const
+{
+	OutElements.Reset();
+
+	if (NumElements == 0 || InRange <= 0.f)
+	{
+		return;
+	}
+
+	// Bounds of the cone: The segment along the view direction extended by the cone radius at its end
+	const float ConeRadius = InMinDot > 0.f ? InRange * FMath::Sqrt(1.f - FMath::Square(InMinDot)) / InMinDot : InRange;
+	const float BoundsExtent = FMath::Min(ConeRadius, InRange);
+
+	const FVector ConeEnd = InOrigin + InDirection * InRange;
+	const FIntVector MinCell = GetCell(InOrigin.ComponentMin(ConeEnd) - FVector(BoundsExtent));
+	const FIntVector MaxCell = GetCell(InOrigin.ComponentMax(ConeEnd) + FVector(BoundsExtent));
+
+	const double RangeSquared = FMath::Square(InRange);
+
+	TArray<TPair<float, int32>, TInlineAllocator<32>> Candidates;
+
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+			{
+				const TArray<int32>* const CellElements = Cells.Find(FIntVector(X, Y, Z));
+				if (!CellElements)
+				{
+					continue;
+				}
+
+				for (const int32 Index : *CellElements)
+				{
+					const FVector Delta = Elements[Index].Location - InOrigin;
+					const double DistanceSquared = Delta.SizeSquared();
+
+					if (DistanceSquared > RangeSquared || DistanceSquared <= UE_KINDA_SMALL_NUMBER)
+					{
+						continue;
+					}
+
+					// Compare the angles without the square root: Dot >= MinDot * Distance
+					const double Dot = FVector::DotProduct(Delta, InDirection);
+					if (Dot <= 0.f || FMath::Square(Dot) < FMath::Square(InMinDot) * DistanceSquared)
+					{
+						continue;
+					}
+
+					Candidates.Emplace(static_cast<float>(Dot / FMath::Sqrt(DistanceSquared)), Index);
+				}
+			}
+		}
+	}
+
+	Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+	{
+		return A.Key > B.Key;
+	});
+
+	OutElements.Reserve(Candidates.Num());
+	for (const TPair<float, int32>& Candidate : Candidates)
+	{
+		OutElements.Add(Candidate.Value);
+	}
+}
+
+FIntVector FPEInteractableSpatialHash::GetCell(const FVector& InLocation) const
+{
+	return FIntVector(FMath::FloorToInt32(InLocation.X / CellSize), FMath::FloorToInt32(InLocation.Y / CellSize), FMath::FloorToInt32(InLocation.Z / CellSize));
+}
+
+UPEInteractableSubsystem::UPEInteractableSubsystem() : SpatialHash(InteractableCellSize)
+{
+}
+
+UPEInteractableSubsystem* UPEInteractableSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* const World = IsValid(WorldContext) ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UPEInteractableSubsystem>() : nullptr;
+}
+
+void UPEInteractableSubsystem::Register(AActor* InActor)
+{
+	if (!IsValid(InActor) || !InActor->Implements<UPEInteractable>() || RegisteredElements.Contains(InActor))
+	{
+		return;
+	}
+
+	// Use the center of the colliding components: The occlusion trace must reach the geometry instead of the actor origin
+	const FBox ActorBounds = InActor->GetComponentsBoundingBox();
+	const FVector BoundsOffset = ActorBounds.IsValid ? ActorBounds.GetCenter() - InActor->GetActorLocation() : FVector::ZeroVector;
+
+	const int32 Element = SpatialHash.Add(InActor->GetActorLocation() + BoundsOffset);
+
+	if (Element >= ElementActors.Num())
+	{
+		ElementActors.SetNum(Element + 1);
+		ElementOffsets.SetNum(Element + 1);
+	}
+
+	ElementActors[Element] = InActor;
+	ElementOffsets[Element] = BoundsOffset;
+	RegisteredElements.Add(InActor, Element);
+
+	if (const USceneComponent* const Root = InActor->GetRootComponent();
+		IsValid(Root) && Root->Mobility == EComponentMobility::Movable)
+	{
+		MovableElements.Add(Element);
+	}
+
+	INC_DWORD_STAT(STAT_PERegisteredInteractables);
+}
+
+void UPEInteractableSubsystem::Unregister(AActor* InActor)
+{
+	int32 Element = INDEX_NONE;
+	if (!RegisteredElements.RemoveAndCopyValue(InActor, Element))
+	{
+		return;
+	}
+
+	SpatialHash.Remove(Element);
+	ElementActors[Element].Reset();
+	MovableElements.RemoveSwap(Element, false);
+
+	DEC_DWORD_STAT(STAT_PERegisteredInteractables);
+}
+
+AActor* UPEInteractableSubsystem::FindFocusCandidate(const FVector& InViewLocation, const FVector& InViewDirection, const float InRange, const float InConeHalfAngle, const FCollisionQueryParams& InParams, FHitResult& OutHitResult) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_PEInteractableFocusQuery);
+
+	OutHitResult.Reset(0.f, false);
+
+	TArray<int32> Candidates;
+	SpatialHash.QueryCone(InViewLocation, InViewDirection, InRange, FMath::Cos(FMath::DegreesToRadians(InConeHalfAngle)), Candidates);
+
+	INC_DWORD_STAT_BY(STAT_PEInteractableFocusCandidates, Candidates.Num());
+
+	int32 NumOcclusionTraces = 0;
+
+	for (const int32 Element : Candidates)
+	{
+		const AActor* const Candidate = ElementActors[Element].Get();
+		if (!IsValid(Candidate) || InParams.GetIgnoredActors().Contains(Candidate->GetUniqueID()))
+		{
+			continue;
+		}
+
+		// Occluded candidates are skipped, up to a few traces per query
+		if (NumOcclusionTraces++ >= MaxFocusOcclusionTraces)
+		{
+			break;
+		}
+
+		// Trace towards the candidate: Anything else blocking the view occludes it
+		const FVector TraceDirection = (SpatialHash.GetLocation(Element) - InViewLocation).GetSafeNormal();
+		GetWorld()->LineTraceSingleByProfile(OutHitResult, InViewLocation, InViewLocation + TraceDirection * InRange, TEXT("Target"), InParams);
+
+		// A registered interactable in front of the candidate is focused instead
+		if (AActor* const HitActor = OutHitResult.bBlockingHit ? OutHitResult.GetActor() : nullptr;
+			IsValid(HitActor) && RegisteredElements.Contains(HitActor))
+		{
+			return HitActor;
+		}
+	}
+
+	OutHitResult.Reset(0.f, false);
+	return nullptr;
+}
+
+int32 UPEInteractableSubsystem::GetNumRegistered() const
+{
+	return RegisteredElements.Num();
+}
+
+void UPEInteractableSubsystem::Tick(const float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PEInteractableRegistryTick);
+
+	Super::Tick(DeltaTime);
+
+	for (const int32 Element : MovableElements)
+	{
+		if (const AActor* const Actor = ElementActors[Element].Get())
+		{
+			SpatialHash.Update(Element, Actor->GetActorLocation() + ElementOffsets[Element]);
+		}
+	}
+}
+
+TStatId UPEInteractableSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPEInteractableSubsystem, STATGROUP_Tickables);
+}
+
+bool UPEInteractableSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand PEInteractablesBenchmarkCommand(
+	TEXT("PE.Interactables.Benchmark"),
+	TEXT("Compare the cost of the focus cone queries of N players against M interactables using the spatial hash and using a linear scan. Usage: PE.Interactables.Benchmark [M=10000] [N=64]"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		const int32 NumInteractables = Args.IsValidIndex(0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 10000;
+		const int32 NumPlayers = Args.IsValidIndex(1) ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 64;
+
+		constexpr float WorldExtent = 20000.f;
+		constexpr float Range = 1000.f;
+		const float MinDot = FMath::Cos(FMath::DegreesToRadians(5.f));
+
+		// Fixed seed: Results are comparable between runs
+		FRandomStream RandomStream(42);
+
+		TArray<FVector> Locations;
+		Locations.Reserve(NumInteractables);
+		for (int32 Iterator = 0; Iterator < NumInteractables; ++Iterator)
+		{
+			Locations.Add(FVector(RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(-WorldExtent, WorldExtent), RandomStream.FRandRange(0.f, 2000.f)));
+		}
+
+		TArray<TPair<FVector, FVector>> Views;
+		Views.Reserve(NumPlayers);
+		for (int32 Iterator = 0; Iterator < NumPlayers; ++Iterator)
+		{
+			// Players looking at random interactables from a few meters away
+			const FVector Target = Locations[RandomStream.RandHelper(NumInteractables)];
+			const FVector Direction = RandomStream.GetUnitVector();
+			Views.Emplace(Target - Direction * RandomStream.FRandRange(100.f, Range), Direction);
+		}
+
+		FPEInteractableSpatialHash SpatialHash(InteractableCellSize);
+
+		const double BuildStartTime = FPlatformTime::Seconds();
+
+		for (const FVector& Location : Locations)
+		{
+			SpatialHash.Add(Location);
+		}
+
+		const double BuildTime = FPlatformTime::Seconds() - BuildStartTime;
+
+		TArray<int32> Candidates;
+		int32 NumHashCandidates = 0;
+
+		const double HashStartTime = FPlatformTime::Seconds();
+
+		for (const TPair<FVector, FVector>& View : Views)
+		{
+			SpatialHash.QueryCone(View.Key, View.Value, Range, MinDot, Candidates);
+			NumHashCandidates += Candidates.Num();
+		}
+
+		const double HashTime = FPlatformTime::Seconds() - HashStartTime;
+
+		int32 NumLinearCandidates = 0;
+
+		const double LinearStartTime = FPlatformTime::Seconds();
+
+		for (const TPair<FVector, FVector>& View : Views)
+		{
+			for (const FVector& Location : Locations)
+			{
+				const FVector Delta = Location - View.Key;
+				if (const double Distance = Delta.Size();
+					Distance <= Range && Distance > UE_KINDA_SMALL_NUMBER && FVector::DotProduct(Delta, View.Value) >= MinDot * Distance)
+				{
+					++NumLinearCandidates;
+				}
+			}
+		}
+
+		const double LinearTime = FPlatformTime::Seconds() - LinearStartTime;
+
+		UE_LOG(LogTemp, Display, TEXT("%s - %d interactables, %d players: Build %.3f ms, spatial hash queries %.3f ms (%d candidates), linear scan %.3f ms (%d candidates) (%.1fx)"), *FString(__func__), NumInteractables, NumPlayers, BuildTime * 1000.0, HashTime * 1000.0, NumHashCandidates, LinearTime * 1000.0, NumLinearCandidates, HashTime > 0.0 ? LinearTime / HashTime : 0.0);
+	}));
+#endif
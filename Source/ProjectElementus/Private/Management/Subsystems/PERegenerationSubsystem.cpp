@@ -0,0 +1,541 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "Management/Subsystems/PERegenerationSubsystem.h"
+#include "GAS/Attributes/PEBasicStatusAS.h"
+#include "Management/Data/PEGlobalTags.h"
+#include "Management/PEProjectSettings.h"
+#include "Management/ProjectElementus.h"
+#include <AbilitySystemComponent.h>
+#include <GameplayEffect.h>
+#include <Math/VectorRegister.h>
+
+DECLARE_CYCLE_STAT(TEXT("Regeneration Update"), STAT_PERegenerationUpdate, STATGROUP_ProjectElementus);
+DECLARE_CYCLE_STAT(TEXT("Regeneration Batch Kernel"), STAT_PERegenerationKernel, STATGROUP_ProjectElementus);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Regeneration Registered Components"), STAT_PERegenerationRegistered, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Regeneration Attribute Writes"), STAT_PERegenerationWrites, STATGROUP_ProjectElementus);
+
+constexpr uint8 RegenerationNumChannels = static_cast<uint8>(EPERegenerationChannel::MAX);
+
+namespace RegenerationChannels
+{
+	FGameplayAttribute GetAttribute(const uint8 InChannel)
+	{
+		switch (static_cast<EPERegenerationChannel>(InChannel))
+		{
+			case EPERegenerationChannel::Health:
+				return UPEBasicStatusAS::GetHealthAttribute();
+
+			case EPERegenerationChannel::Stamina:
+				return UPEBasicStatusAS::GetStaminaAttribute();
+
+			case EPERegenerationChannel::Mana:
+				return UPEBasicStatusAS::GetManaAttribute();
+
+			default:
+				return FGameplayAttribute();
+		}
+	}
+
+	FGameplayAttribute GetMaxAttribute(const uint8 InChannel)
+	{
+		switch (static_cast<EPERegenerationChannel>(InChannel))
+		{
+			case EPERegenerationChannel::Health:
+				return UPEBasicStatusAS::GetMaxHealthAttribute();
+
+			case EPERegenerationChannel::Stamina:
+				return UPEBasicStatusAS::GetMaxStaminaAttribute();
+
+			case EPERegenerationChannel::Mana:
+				return UPEBasicStatusAS::GetMaxManaAttribute();
+
+			default:
+				return FGameplayAttribute();
+		}
+	}
+
+	FGameplayTag GetBlockTag(const uint8 InChannel)
+	{
+		switch (static_cast<EPERegenerationChannel>(InChannel))
+		{
+			case EPERegenerationChannel::Health:
+				return GlobalTag_RegenBlock_Health;
+
+			case EPERegenerationChannel::Stamina:
+				return GlobalTag_RegenBlock_Stamina;
+
+			case EPERegenerationChannel::Mana:
+				return GlobalTag_RegenBlock_Mana;
+
+			default:
+				return FGameplayTag();
+		}
+	}
+
+	FGameplayTag GetAbilityTag(const uint8 InChannel)
+	{
+		switch (static_cast<EPERegenerationChannel>(InChannel))
+		{
+			case EPERegenerationChannel::Health:
+				return GlobalTag_Ability_Regeneration_Health;
+
+			case EPERegenerationChannel::Stamina:
+				return GlobalTag_Ability_Regeneration_Stamina;
+
+			case EPERegenerationChannel::Mana:
+				return GlobalTag_Ability_Regeneration_Mana;
+
+			default:
+				return FGameplayTag();
+		}
+	}
+
+	float GetDefaultRate(const uint8 InChannel)
+	{
+		const UPEProjectSettings* const ProjectSettings = GetDefault<UPEProjectSettings>();
+
+		switch (static_cast<EPERegenerationChannel>(InChannel))
+		{
+			case EPERegenerationChannel::Health:
+				return ProjectSettings->HealthRegenerationRate;
+
+			case EPERegenerationChannel::Stamina:
+				return ProjectSettings->StaminaRegenerationRate;
+
+			case EPERegenerationChannel::Mana:
+				return ProjectSettings->ManaRegenerationRate;
+
+			default:
+				return 0.f;
+		}
+	}
+}
+
+UPERegenerationSubsystem* UPERegenerationSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* const World = IsValid(WorldContext) ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UPERegenerationSubsystem>() : nullptr;
+}
+
+void UPERegenerationSubsystem::Register(UAbilitySystemComponent* InABSC)
+{
+	if (!IsValid(InABSC) || !InABSC->IsOwnerActorAuthoritative() || RegisteredIndices.Contains(InABSC))
+	{
+		return;
+	}
+
+	const int32 Index = RegisteredABSCs.Add(InABSC);
+	RegisteredKeys.Add(InABSC);
+	RegisteredIndices.Add(InABSC, Index);
+
+	for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+	{
+		FRegenerationChannelData& ChannelData = Channels[Channel];
+		ChannelData.Values.Add(0.f);
+		ChannelData.MaxValues.Add(0.f);
+		ChannelData.Rates.Add(RegenerationChannels::GetDefaultRate(Channel));
+		ChannelData.Gates.Add(1.f);
+
+		InABSC->RegisterGameplayTagEvent(RegenerationChannels::GetBlockTag(Channel), EGameplayTagEventType::NewOrRemoved).AddUObject(this, &UPERegenerationSubsystem::OnBlockTagChanged_Callback, TObjectKey<UAbilitySystemComponent>(InABSC));
+	}
+
+	// Dead characters doesn't regenerate
+	InABSC->RegisterGameplayTagEvent(GlobalTag_DeadState, EGameplayTagEventType::NewOrRemoved).AddUObject(this, &UPERegenerationSubsystem::OnBlockTagChanged_Callback, TObjectKey<UAbilitySystemComponent>(InABSC));
+
+	UpdateGates(Index);
+
+	INC_DWORD_STAT(STAT_PERegenerationRegistered);
+}
+
+void UPERegenerationSubsystem::Unregister(UAbilitySystemComponent* InABSC)
+{
+	if (const int32* const Index = RegisteredIndices.Find(InABSC))
+	{
+		RemoveEntry(*Index);
+	}
+}
+
+void UPERegenerationSubsystem::SetRegenerationRate(const UAbilitySystemComponent* InABSC, const EPERegenerationChannel InChannel, const float InRate)
+{
+	if (InChannel == EPERegenerationChannel::MAX)
+	{
+		return;
+	}
+
+	if (const int32* const Index = RegisteredIndices.Find(InABSC))
+	{
+		Channels[static_cast<uint8>(InChannel)].Rates[*Index] = FMath::Max(InRate, 0.f);
+	}
+}
+
+bool UPERegenerationSubsystem::IsChannelEnabled(const EPERegenerationChannel InChannel)
+{
+	return InChannel != EPERegenerationChannel::MAX && RegenerationChannels::GetDefaultRate(static_cast<uint8>(InChannel)) > 0.f;
+}
+
+bool UPERegenerationSubsystem::IsReplacedRegenerationAbility(const FGameplayTagContainer& AbilityTags)
+{
+	for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+	{
+		if (AbilityTags.HasTagExact(RegenerationChannels::GetAbilityTag(Channel)) && IsChannelEnabled(static_cast<EPERegenerationChannel>(Channel)))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 UPERegenerationSubsystem::GetNumRegistered() const
+{
+	return RegisteredABSCs.Num();
+}
+
+void UPERegenerationSubsystem::RegenerateBatch(const TArrayView<float> Values, const TArrayView<const float> MaxValues, const TArrayView<const float> Rates, const TArrayView<const float> Gates, const float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PERegenerationKernel);
+
+	const int32 NumValues = Values.Num();
+	check(MaxValues.Num() == NumValues && Rates.Num() == NumValues && Gates.Num() == NumValues);
+
+	// Values above the maximum (e.g. after a max value reduction) are kept untouched instead of being reduced
+	const VectorRegister4Float Delta = VectorSetFloat1(DeltaTime);
+	const int32 NumVectorized = NumValues & ~3;
+
+	for (int32 Index = 0; Index < NumVectorized; Index += 4)
+	{
+		const VectorRegister4Float Value = VectorLoad(&Values[Index]);
+		const VectorRegister4Float MaxValue = VectorLoad(&MaxValues[Index]);
+		const VectorRegister4Float Rate = VectorMultiply(VectorLoad(&Rates[Index]), VectorLoad(&Gates[Index]));
+
+		const VectorRegister4Float Regenerated = VectorMin(VectorMultiplyAdd(Rate, Delta, Value), MaxValue);
+
+		VectorStore(VectorMax(Value, Regenerated), &Values[Index]);
+	}
+
+	for (int32 Index = NumVectorized; Index < NumValues; ++Index)
+	{
+		const float Regenerated = FMath::Min(Values[Index] + Rates[Index] * Gates[Index] * DeltaTime, MaxValues[Index]);
+		Values[Index] = FMath::Max(Values[Index], Regenerated);
+	}
+}
+
+void UPERegenerationSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (RegisteredABSCs.IsEmpty())
+	{
+		ElapsedTime = 0.f;
+		return;
+	}
+
+	const float Interval = FMath::Max(GetDefault<UPEProjectSettings>()->RegenerationInterval, 0.01f);
+
+	ElapsedTime += DeltaTime;
+	if (ElapsedTime < Interval)
+	{
+		return;
+	}
+
+	// Long frames are compensated by regenerating all the elapsed intervals in a single update
+	const float NumIntervals = FMath::FloorToFloat(ElapsedTime / Interval);
+	ElapsedTime -= NumIntervals * Interval;
+
+	UpdateRegeneration(NumIntervals * Interval);
+}
+
+TStatId UPERegenerationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPERegenerationSubsystem, STATGROUP_Tickables);
+}
+
+bool UPERegenerationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPERegenerationSubsystem::UpdateRegeneration(const float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PERegenerationUpdate);
+
+	for (int32 Index = RegisteredABSCs.Num() - 1; Index >= 0; --Index)
+	{
+		if (!RegisteredABSCs[Index].IsValid())
+		{
+			RemoveEntry(Index);
+		}
+	}
+
+	const int32 NumEntries = RegisteredABSCs.Num();
+
+	// Channels without any entry regenerating (e.g. all rates are 0, the default) don't need to touch the attribute sets
+	bool ActiveChannels[RegenerationNumChannels];
+	bool bHasActiveChannel = false;
+
+	for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+	{
+		const FRegenerationChannelData& ChannelData = Channels[Channel];
+
+		ActiveChannels[Channel] = false;
+		for (int32 Index = 0; Index < NumEntries && !ActiveChannels[Channel]; ++Index)
+		{
+			ActiveChannels[Channel] = ChannelData.Rates[Index] * ChannelData.Gates[Index] > 0.f;
+		}
+
+		bHasActiveChannel |= ActiveChannels[Channel];
+	}
+
+	if (!bHasActiveChannel)
+	{
+		return;
+	}
+
+	// Components without the basic status attributes yet (e.g. waiting for a game feature) are kept with zeroed values
+	TArray<bool, TInlineAllocator<256>> HasAttributes;
+	HasAttributes.SetNumUninitialized(NumEntries);
+
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		const UAbilitySystemComponent* const ABSC = RegisteredABSCs[Index].Get();
+		HasAttributes[Index] = ABSC->GetSet<UPEBasicStatusAS>() != nullptr;
+	}
+
+	TArray<float, TInlineAllocator<256>> PreviousValues;
+
+	for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+	{
+		if (!ActiveChannels[Channel])
+		{
+			continue;
+		}
+
+		FRegenerationChannelData& ChannelData = Channels[Channel];
+
+		const FGameplayAttribute Attribute = RegenerationChannels::GetAttribute(Channel);
+		const FGameplayAttribute MaxAttribute = RegenerationChannels::GetMaxAttribute(Channel);
+
+		// Gather: The values may be changed by effects between the updates, so they're always read back from the attribute sets
+		// Entries that aren't regenerating are zeroed: The kernel keeps them at 0 and they're skipped by the write back
+		for (int32 Index = 0; Index < NumEntries; ++Index)
+		{
+			const UAbilitySystemComponent* const ABSC = RegisteredABSCs[Index].Get();
+			const bool bShouldGather = HasAttributes[Index] && ChannelData.Rates[Index] * ChannelData.Gates[Index] > 0.f;
+
+			ChannelData.Values[Index] = bShouldGather ? ABSC->GetNumericAttributeBase(Attribute) : 0.f;
+			ChannelData.MaxValues[Index] = bShouldGather ? ABSC->GetNumericAttribute(MaxAttribute) : 0.f;
+		}
+
+		PreviousValues.Reset();
+		PreviousValues.Append(ChannelData.Values);
+
+		RegenerateBatch(ChannelData.Values, ChannelData.MaxValues, ChannelData.Rates, ChannelData.Gates, DeltaTime);
+
+		// Write back through the ability system component: The attribute set will replicate the new value and notify the listeners
+		for (int32 Index = 0; Index < NumEntries; ++Index)
+		{
+			if (ChannelData.Values[Index] <= PreviousValues[Index])
+			{
+				continue;
+			}
+
+			RegisteredABSCs[Index]->SetNumericAttributeBase(Attribute, ChannelData.Values[Index]);
+			INC_DWORD_STAT(STAT_PERegenerationWrites);
+		}
+	}
+}
+
+void UPERegenerationSubsystem::RemoveEntry(const int32 Index)
+{
+	if (UAbilitySystemComponent* const ABSC = RegisteredABSCs[Index].Get())
+	{
+		for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+		{
+			ABSC->RegisterGameplayTagEvent(RegenerationChannels::GetBlockTag(Channel), EGameplayTagEventType::NewOrRemoved).RemoveAll(this);
+		}
+
+		ABSC->RegisterGameplayTagEvent(GlobalTag_DeadState, EGameplayTagEventType::NewOrRemoved).RemoveAll(this);
+	}
+
+	// Keys are kept apart since the weak pointer of a destroyed component can't be used to find its entry
+	RegisteredIndices.Remove(RegisteredKeys[Index]);
+
+	RegisteredABSCs.RemoveAtSwap(Index, 1, false);
+	RegisteredKeys.RemoveAtSwap(Index, 1, false);
+
+	for (FRegenerationChannelData& ChannelData : Channels)
+	{
+		ChannelData.Values.RemoveAtSwap(Index, 1, false);
+		ChannelData.MaxValues.RemoveAtSwap(Index, 1, false);
+		ChannelData.Rates.RemoveAtSwap(Index, 1, false);
+		ChannelData.Gates.RemoveAtSwap(Index, 1, false);
+	}
+
+	// Update the index of the entry moved to the removed position
+	if (RegisteredKeys.IsValidIndex(Index))
+	{
+		RegisteredIndices.FindChecked(RegisteredKeys[Index]) = Index;
+	}
+
+	DEC_DWORD_STAT(STAT_PERegenerationRegistered);
+}
+
+void UPERegenerationSubsystem::UpdateGates(const int32 Index)
+{
+	const UAbilitySystemComponent* const ABSC = RegisteredABSCs[Index].Get();
+	if (!IsValid(ABSC))
+	{
+		return;
+	}
+
+	const bool bIsDead = ABSC->HasMatchingGameplayTag(GlobalTag_DeadState);
+
+	for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+	{
+		const bool bIsBlocked = bIsDead || ABSC->HasMatchingGameplayTag(RegenerationChannels::GetBlockTag(Channel));
+		Channels[Channel].Gates[Index] = bIsBlocked ? 0.f : 1.f;
+	}
+}
+
+void UPERegenerationSubsystem::OnBlockTagChanged_Callback([[maybe_unused]] const FGameplayTag BlockTag, [[maybe_unused]] const int32 NewCount, const TObjectKey<UAbilitySystemComponent> ABSCKey)
+{
+	if (const int32* const Index = RegisteredIndices.Find(ABSCKey))
+	{
+		UpdateGates(*Index);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs PERegenerationBenchmarkCommand(
+	TEXT("PE.Regeneration.Benchmark"),
+	TEXT("Compare the cost of a regeneration interval for N characters using the regeneration subsystem and using the periodic regeneration effects. Must be executed on the server. Usage: PE.Regeneration.Benchmark [N=200]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UPERegenerationSubsystem* const Regeneration = UPERegenerationSubsystem::Get(World);
+
+		if (!IsValid(Regeneration) || World->GetNetMode() == NM_Client)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%s - The benchmark requires a game world with authority"), *FString(__func__));
+			return;
+		}
+
+		// Periodic effects applied by the regeneration abilities (GA_Regeneration_*), in the channels order
+		const TCHAR* const EffectPaths[RegenerationNumChannels] =
+		{
+			TEXT("/Game/Main/GAS/Effects/Shared/GE_Health_Regen_Infinite_Shared.GE_Health_Regen_Infinite_Shared_C"),
+			TEXT("/Game/Main/GAS/Effects/Shared/GE_Stamina_Regen_Infinite_Shared.GE_Stamina_Regen_Infinite_Shared_C"),
+			TEXT("/Game/Main/GAS/Effects/Shared/GE_Mana_Regen_Infinite_Shared.GE_Mana_Regen_Infinite_Shared_C")
+		};
+
+		const UGameplayEffect* RegenerationEffects[RegenerationNumChannels];
+
+		for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+		{
+			const UClass* const EffectClass = LoadClass<UGameplayEffect>(nullptr, EffectPaths[Channel]);
+			if (!IsValid(EffectClass))
+			{
+				UE_LOG(LogTemp, Warning, TEXT("%s - Failed to load the regeneration effect %s"), *FString(__func__), EffectPaths[Channel]);
+				return;
+			}
+
+			RegenerationEffects[Channel] = EffectClass->GetDefaultObject<UGameplayEffect>();
+		}
+
+		const int32 NumCharacters = Args.IsEmpty() ? 200 : FMath::Max(FCString::Atoi(*Args[0]), 1);
+		const int32 NumAlreadyRegistered = Regeneration->GetNumRegistered();
+		const float Interval = FMath::Max(GetDefault<UPEProjectSettings>()->RegenerationInterval, 0.01f);
+
+		// Transient characters: An actor with an ability system component and empty basic status attributes each
+		TArray<AActor*> Actors;
+		TArray<UAbilitySystemComponent*> ABSCs;
+
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+
+		for (int32 Iterator = 0; Iterator < NumCharacters; ++Iterator)
+		{
+			AActor* const Actor = World->SpawnActor<AActor>(SpawnParameters);
+
+			UAbilitySystemComponent* const ABSC = NewObject<UAbilitySystemComponent>(Actor);
+			ABSC->RegisterComponent();
+			ABSC->InitAbilityActorInfo(Actor, Actor);
+			ABSC->AddAttributeSetSubobject(NewObject<UPEBasicStatusAS>(Actor));
+
+			Actors.Add(Actor);
+			ABSCs.Add(ABSC);
+		}
+
+		const auto ResetAttributes = [&ABSCs]
+		{
+			for (UAbilitySystemComponent* const ABSC : ABSCs)
+			{
+				for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+				{
+					ABSC->SetNumericAttributeBase(RegenerationChannels::GetMaxAttribute(Channel), 100.f);
+					ABSC->SetNumericAttributeBase(RegenerationChannels::GetAttribute(Channel), 0.f);
+				}
+			}
+		};
+
+		// Subsystem: A single update of every registered character with all channels regenerating
+		ResetAttributes();
+
+		for (UAbilitySystemComponent* const ABSC : ABSCs)
+		{
+			Regeneration->Register(ABSC);
+
+			for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+			{
+				Regeneration->SetRegenerationRate(ABSC, static_cast<EPERegenerationChannel>(Channel), 1.f);
+			}
+		}
+
+		const double SubsystemStartTime = FPlatformTime::Seconds();
+		Regeneration->Tick(Interval);
+		const double SubsystemTime = FPlatformTime::Seconds() - SubsystemStartTime;
+
+		for (UAbilitySystemComponent* const ABSC : ABSCs)
+		{
+			Regeneration->Unregister(ABSC);
+		}
+
+		// Periodic effects: A single period of the infinite regeneration effect of every channel
+		ResetAttributes();
+
+		TArray<TPair<UAbilitySystemComponent*, FActiveGameplayEffectHandle>> ActiveEffects;
+
+		for (UAbilitySystemComponent* const ABSC : ABSCs)
+		{
+			for (uint8 Channel = 0; Channel < RegenerationNumChannels; ++Channel)
+			{
+				FGameplayEffectSpec Spec(RegenerationEffects[Channel], ABSC->MakeEffectContext(), 1.f);
+				Spec.SetSetByCallerMagnitude(GlobalTag_SetByCallerFloat1, 1.f);
+
+				ActiveEffects.Emplace(ABSC, ABSC->ApplyGameplayEffectSpecToSelf(Spec));
+			}
+		}
+
+		const double EffectStartTime = FPlatformTime::Seconds();
+
+		for (const TPair<UAbilitySystemComponent*, FActiveGameplayEffectHandle>& ActiveEffect : ActiveEffects)
+		{
+			ActiveEffect.Key->ExecutePeriodicEffect(ActiveEffect.Value);
+		}
+
+		const double EffectTime = FPlatformTime::Seconds() - EffectStartTime;
+
+		for (const TPair<UAbilitySystemComponent*, FActiveGameplayEffectHandle>& ActiveEffect : ActiveEffects)
+		{
+			ActiveEffect.Key->RemoveActiveGameplayEffect(ActiveEffect.Value);
+		}
+
+		for (AActor* const Actor : Actors)
+		{
+			Actor->Destroy();
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("%s - %d characters (%d already registered): Regeneration subsystem %.3f ms, periodic effects %.3f ms (%.1fx)"), *FString(__func__), NumCharacters, NumAlreadyRegistered, SubsystemTime * 1000.0, EffectTime * 1000.0, SubsystemTime > 0.0 ? EffectTime / SubsystemTime : 0.0);
+	}));
+#endif
@@ -0,0 +1,186 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#include "Management/Subsystems/PETimingWheelSubsystem.h"
+#include "Management/ProjectElementus.h"
+
+DECLARE_CYCLE_STAT(TEXT("Timing Wheel Tick"), STAT_PETimingWheelTick, STATGROUP_ProjectElementus);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Timing Wheel Pending Expirations"), STAT_PETimingWheelPending, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Timing Wheel Expirations"), STAT_PETimingWheelExpirations, STATGROUP_ProjectElementus);
+
+/* 1024 slots with a resolution of 1/30 seconds: a full revolution covers ~34 seconds, longer delays wait for extra revolutions */
+constexpr int32 TimingWheelNumSlots = 1024;
+constexpr int32 TimingWheelSlotMask = TimingWheelNumSlots - 1;
+constexpr double TimingWheelResolution = 1.0 / 30.0;
+
+UPETimingWheelSubsystem* UPETimingWheelSubsystem::Get(const UObject* WorldContext)
+{
+	const UWorld* const World = IsValid(WorldContext) ? WorldContext->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UPETimingWheelSubsystem>() : nullptr;
+}
+
+FPETimingWheelHandle UPETimingWheelSubsystem::Schedule(const float InDelay, FSimpleDelegate&& InDelegate)
+{
+	if (Slots.IsEmpty())
+	{
+		Slots.SetNum(TimingWheelNumSlots);
+	}
+
+	const int32 Index = FreeEntries.IsEmpty() ? Entries.AddDefaulted() : FreeEntries.Pop(false);
+
+	// Serial 0 is reserved for invalid handles
+	NextSerial = NextSerial == 0 ? 1 : NextSerial;
+
+	FWheelEntry& Entry = Entries[Index];
+	Entry.Delegate = MoveTemp(InDelegate);
+	Entry.Serial = NextSerial++;
+
+	// Round up from the exact elapsed time: CurrentTick is floored and would make the expiration fire up to one tick early
+	// Always wait at least one tick so an expiration scheduled inside a callback is not processed in the same pass
+	const int64 DueTick = FMath::CeilToInt64((ElapsedTime + FMath::Max(InDelay, 0.f)) / TimingWheelResolution);
+	Entry.ExpirationTick = FMath::Max<int64>(CurrentTick + 1, DueTick);
+
+	Slots[Entry.ExpirationTick & TimingWheelSlotMask].Add(FWheelSlotEntry{ Index, Entry.Serial });
+
+	++NumPending;
+	INC_DWORD_STAT(STAT_PETimingWheelPending);
+
+	FPETimingWheelHandle Handle;
+	Handle.Index = Index;
+	Handle.Serial = Entry.Serial;
+
+	return Handle;
+}
+
+void UPETimingWheelSubsystem::Cancel(FPETimingWheelHandle& InHandle)
+{
+	// The slot reference is left behind and discarded when its slot is processed
+	if (IsPending(InHandle))
+	{
+		ReleaseEntry(InHandle.Index);
+	}
+
+	InHandle.Invalidate();
+}
+
+bool UPETimingWheelSubsystem::IsPending(const FPETimingWheelHandle& InHandle) const
+{
+	return InHandle.IsValid() && Entries.IsValidIndex(InHandle.Index) && Entries[InHandle.Index].Serial == InHandle.Serial;
+}
+
+int32 UPETimingWheelSubsystem::GetNumPending() const
+{
+	return NumPending;
+}
+
+void UPETimingWheelSubsystem::Tick(const float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_PETimingWheelTick);
+
+	Super::Tick(DeltaTime);
+
+	ElapsedTime += DeltaTime;
+
+	const int64 TargetTick = FMath::FloorToInt64(ElapsedTime / TimingWheelResolution);
+	if (TargetTick <= CurrentTick)
+	{
+		return;
+	}
+
+	if (NumPending > 0)
+	{
+		// Each slot needs to be visited only once even if the frame took longer than a full revolution
+		const int64 LastTick = FMath::Min(TargetTick, CurrentTick + TimingWheelNumSlots);
+
+		for (int64 Tick = CurrentTick + 1; Tick <= LastTick; ++Tick)
+		{
+			TArray<FWheelSlotEntry>& Slot = Slots[Tick & TimingWheelSlotMask];
+
+			for (int32 SlotIndex = Slot.Num() - 1; SlotIndex >= 0; --SlotIndex)
+			{
+				const FWheelSlotEntry SlotEntry = Slot[SlotIndex];
+				FWheelEntry& Entry = Entries[SlotEntry.Index];
+
+				// Canceled or already reused by another expiration
+				if (Entry.Serial != SlotEntry.Serial)
+				{
+					Slot.RemoveAtSwap(SlotIndex, 1, false);
+					continue;
+				}
+
+				// Scheduled for a later revolution
+				if (Entry.ExpirationTick > TargetTick)
+				{
+					continue;
+				}
+
+				ExpiredDelegates.Add(MoveTemp(Entry.Delegate));
+				ReleaseEntry(SlotEntry.Index);
+
+				Slot.RemoveAtSwap(SlotIndex, 1, false);
+			}
+		}
+	}
+
+	CurrentTick = TargetTick;
+
+	if (ExpiredDelegates.IsEmpty())
+	{
+		return;
+	}
+
+	INC_DWORD_STAT_BY(STAT_PETimingWheelExpirations, ExpiredDelegates.Num());
+
+	// Callbacks are executed after the wheel update since they may schedule or cancel other expirations
+	for (const FSimpleDelegate& Delegate : ExpiredDelegates)
+	{
+		Delegate.ExecuteIfBound();
+	}
+
+	ExpiredDelegates.Reset();
+}
+
+TStatId UPETimingWheelSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UPETimingWheelSubsystem, STATGROUP_Tickables);
+}
+
+bool UPETimingWheelSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPETimingWheelSubsystem::ReleaseEntry(const int32 Index)
+{
+	FWheelEntry& Entry = Entries[Index];
+	Entry.Delegate.Unbind();
+	Entry.Serial = 0;
+
+	FreeEntries.Add(Index);
+
+	--NumPending;
+	DEC_DWORD_STAT(STAT_PETimingWheelPending);
+}
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs PETimingWheelStressCommand(
+	TEXT("PE.TimingWheel.Stress"),
+	TEXT("Schedule N empty expirations spread over the next 60 seconds. Use with 'stat ProjectElementus' to profile the wheel. Usage: PE.TimingWheel.Stress [N=10000]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UPETimingWheelSubsystem* const Wheel = UPETimingWheelSubsystem::Get(World);
+		if (!IsValid(Wheel))
+		{
+			return;
+		}
+
+		const int32 Count = Args.IsEmpty() ? 10000 : FCString::Atoi(*Args[0]);
+		for (int32 Iterator = 0; Iterator < Count; ++Iterator)
+		{
+			Wheel->Schedule(FMath::FRandRange(0.f, 60.f), FSimpleDelegate::CreateLambda([] {}));
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("%s - Scheduled %d expirations, %d pending"), *FString(__func__), Count, Wheel->GetNumPending());
+	}));
+#endif
@@ -3,11 +3,205 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "ViewModels/Attributes/PEVM_AttributeBase.h"
+#include "Management/ProjectElementus.h"
+#include <AbilitySystemComponent.h>
 
-UPEVM_AttributeBase::UPEVM_AttributeBase(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+DECLARE_CYCLE_STAT(TEXT("ViewModel Attribute Dispatch"), STAT_PEViewModelAttributeDispatch, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ViewModel Flushes"), STAT_PEViewModelFlushes, STATGROUP_ProjectElementus);
+DECLARE_DWORD_COUNTER_STAT(TEXT("ViewModel Coalesced Changes"), STAT_PEViewModelCoalescedChanges, STATGROUP_ProjectElementus);
+
+UPEVM_AttributeBase::UPEVM_AttributeBase(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), DirtyFields(0u)
+{
+}
+
+void UPEVM_AttributeBase::PostInitProperties()
 {
+	Super::PostInitProperties();
+
+	if (!HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		BuildFieldTable();
+	}
+}
+
+void UPEVM_AttributeBase::BuildFieldTable()
+{
+	Fields.Reset();
+
+	const UE::FieldNotification::IClassDescriptor& Descriptor = GetFieldNotificationDescriptor();
+
+	for (TFieldIterator<FFloatProperty> Iterator(GetClass()); Iterator; ++Iterator)
+	{
+		FFloatProperty* const Property = *Iterator;
+
+		UE::FieldNotification::FFieldId FieldId;
+		Descriptor.ForEachField(GetClass(), [&FieldId, Property](const UE::FieldNotification::FFieldId InFieldId) -> bool
+		{
+			if (InFieldId.GetName() == Property->GetFName())
+			{
+				FieldId = InFieldId;
+				return false;
+			}
+
+			return true;
+		});
+
+		// Only properties that notify their changes can be bound
+		if (!FieldId.IsValid())
+		{
+			continue;
+		}
+
+		if (!ensureAlwaysMsgf(Fields.Num() < 32, TEXT("%s - View model %s have more than 32 attribute fields"), *FString(__func__), *GetName()))
+		{
+			break;
+		}
+
+		Fields.Add(FAttributeField{ Property, FieldId });
+	}
+
+	PendingValues.SetNumZeroed(Fields.Num());
+}
+
+bool UPEVM_AttributeBase::BindAttributeSet(UAbilitySystemComponent* AbilitySystemComponent, const UAttributeSet* AttributeSet)
+{
+	if (!IsValid(AbilitySystemComponent) || !IsValid(AttributeSet))
+	{
+		return false;
+	}
+
+	bool bBoundAny = false;
+
+	for (int32 FieldIndex = 0; FieldIndex < Fields.Num(); ++FieldIndex)
+	{
+		FProperty* const AttributeProperty = FindFProperty<FProperty>(AttributeSet->GetClass(), Fields[FieldIndex].Property->GetFName());
+		if (!AttributeProperty || !FGameplayAttribute::IsGameplayAttributeDataProperty(AttributeProperty))
+		{
+			continue;
+		}
+
+		const FGameplayAttribute Attribute(AttributeProperty);
+		AttributeFieldIndices.Add(Attribute, static_cast<uint8>(FieldIndex));
+
+		FOnGameplayAttributeValueChange& ChangeDelegate = AbilitySystemComponent->GetGameplayAttributeValueChangeDelegate(Attribute);
+		ChangeDelegate.RemoveAll(this);
+		ChangeDelegate.AddUObject(this, &UPEVM_AttributeBase::OnAttributeChange);
+
+		// The view model is only updated when the attribute changes after the binding occurs: stage the current value
+		MarkFieldDirty(static_cast<uint8>(FieldIndex), Attribute.GetNumericValue(AttributeSet));
+		bBoundAny = true;
+	}
+
+	// Initial values are applied right away instead of waiting for the next frame
+	FlushDirtyFields();
+
+	return bBoundAny;
 }
 
 void UPEVM_AttributeBase::OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData)
-{	
+{
+	SCOPE_CYCLE_COUNTER(STAT_PEViewModelAttributeDispatch);
+
+	if (const uint8* const FieldIndex = AttributeFieldIndices.Find(AttributeChangeData.Attribute))
+	{
+		MarkFieldDirty(*FieldIndex, AttributeChangeData.NewValue);
+	}
+}
+
+void UPEVM_AttributeBase::FlushDirtyFields()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	const uint32 FieldsToFlush = DirtyFields;
+	if (FieldsToFlush == 0u)
+	{
+		return;
+	}
+
+	DirtyFields = 0u;
+
+	INC_DWORD_STAT(STAT_PEViewModelFlushes);
+
+	uint32 ChangedFields = 0u;
+	for (int32 FieldIndex = 0; FieldIndex < Fields.Num(); ++FieldIndex)
+	{
+		const uint32 FieldMask = 1u << FieldIndex;
+		if ((FieldsToFlush & FieldMask) == 0u)
+		{
+			continue;
+		}
+
+		const FAttributeField& Field = Fields[FieldIndex];
+		if (Field.Property->GetPropertyValue_InContainer(this) == PendingValues[FieldIndex])
+		{
+			continue;
+		}
+
+		Field.Property->SetPropertyValue_InContainer(this, PendingValues[FieldIndex]);
+		BroadcastFieldValueChanged(Field.FieldId);
+
+		ChangedFields |= FieldMask;
+	}
+
+	if (ChangedFields != 0u)
+	{
+		OnFieldsChanged(ChangedFields);
+	}
+}
+
+void UPEVM_AttributeBase::BeginDestroy()
+{
+	if (FlushTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+		FlushTickerHandle.Reset();
+	}
+
+	Super::BeginDestroy();
+}
+
+void UPEVM_AttributeBase::OnFieldsChanged(const uint32 ChangedFields)
+{
+}
+
+uint32 UPEVM_AttributeBase::GetFieldMask(const FName PropertyName) const
+{
+	const int32 FieldIndex = Fields.IndexOfByPredicate([PropertyName](const FAttributeField& Field)
+	{
+		return Field.Property->GetFName() == PropertyName;
+	});
+
+	return FieldIndex == INDEX_NONE ? 0u : 1u << FieldIndex;
+}
+
+void UPEVM_AttributeBase::MarkFieldDirty(const uint8 FieldIndex, const float InValue)
+{
+	check(Fields.IsValidIndex(FieldIndex));
+
+	PendingValues[FieldIndex] = InValue;
+
+	// Each overwritten value is a broadcast that will not happen
+	const uint32 FieldMask = 1u << FieldIndex;
+	if ((DirtyFields & FieldMask) != 0u)
+	{
+		INC_DWORD_STAT(STAT_PEViewModelCoalescedChanges);
+		return;
+	}
+
+	DirtyFields |= FieldMask;
+
+	if (!FlushTickerHandle.IsValid())
+	{
+		FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](const float) -> bool
+		{
+			FlushTickerHandle.Reset();
+			FlushDirtyFields();
+
+			return false;
+		}));
+	}
 }
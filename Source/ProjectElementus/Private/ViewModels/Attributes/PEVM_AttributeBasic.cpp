@@ -3,7 +3,6 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "ViewModels/Attributes/PEVM_AttributeBasic.h"
-#include "GAS/Attributes/PEBasicStatusAS.h"
 
 UPEVM_AttributeBasic::UPEVM_AttributeBasic(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), Health(-1.f), MaxHealth(-1.f), Mana(-1.f), MaxMana(-1.f), Stamina(-1.f), MaxStamina(-1.f)
 {
@@ -19,18 +18,25 @@ float UPEVM_AttributeBasic::GetHealthPercent() const
 	return Health / MaxHealth;
 }
 
-void UPEVM_AttributeBasic::OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData)
+void UPEVM_AttributeBasic::OnFieldsChanged(const uint32 ChangedFields)
 {
-	Super::OnAttributeChange(AttributeChangeData);
+	Super::OnFieldsChanged(ChangedFields);
 
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPEBasicStatusAS, Health);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPEBasicStatusAS, MaxHealth);
+	// The percent fields depends on both values: broadcast them once after all changes of the frame were applied
+	if (ChangedFields & (GetFieldMask(GET_MEMBER_NAME_CHECKED(ThisClass, Health)) | GetFieldMask(GET_MEMBER_NAME_CHECKED(ThisClass, MaxHealth))))
+	{
+		UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(GetHealthPercent);
+	}
 
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPEBasicStatusAS, Mana);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPEBasicStatusAS, MaxMana);
+	if (ChangedFields & (GetFieldMask(GET_MEMBER_NAME_CHECKED(ThisClass, Mana)) | GetFieldMask(GET_MEMBER_NAME_CHECKED(ThisClass, MaxMana))))
+	{
+		UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(GetManaPercent);
+	}
 
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPEBasicStatusAS, Stamina);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPEBasicStatusAS, MaxStamina);
+	if (ChangedFields & (GetFieldMask(GET_MEMBER_NAME_CHECKED(ThisClass, Stamina)) | GetFieldMask(GET_MEMBER_NAME_CHECKED(ThisClass, MaxStamina))))
+	{
+		UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(GetStaminaPercent);
+	}
 }
 
 void UPEVM_AttributeBasic::SetHealth(const float InValue)
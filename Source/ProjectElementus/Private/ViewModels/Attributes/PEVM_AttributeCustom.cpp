@@ -3,23 +3,11 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "ViewModels/Attributes/PEVM_AttributeCustom.h"
-#include "GAS/Attributes/PECustomStatusAS.h"
 
 UPEVM_AttributeCustom::UPEVM_AttributeCustom(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), AttackRate(-1.f), DefenseRate(-1.f), SpeedRate(-1.f), JumpRate(-1.f), Gold(-1.f)
 {	
 }
 
-void UPEVM_AttributeCustom::OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData)
-{
-	Super::OnAttributeChange(AttributeChangeData);
-
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPECustomStatusAS, AttackRate);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPECustomStatusAS, DefenseRate);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPECustomStatusAS, SpeedRate);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPECustomStatusAS, JumpRate);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPECustomStatusAS, Gold);
-}
-
 void UPEVM_AttributeCustom::SetAttackRate(const float InValue)
 {
 	if (InValue == AttackRate)
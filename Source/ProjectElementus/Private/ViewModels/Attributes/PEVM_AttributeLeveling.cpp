@@ -3,7 +3,6 @@
 // Repo: https://github.com/lucoiso/UEProject_Elementus
 
 #include "ViewModels/Attributes/PEVM_AttributeLeveling.h"
-#include "GAS/Attributes/PELevelingAS.h"
 
 UPEVM_AttributeLeveling::UPEVM_AttributeLeveling(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer), CurrentLevel(-1.f), CurrentExperience(-1.f), RequiredExperience(-1.f)
 {	
@@ -19,13 +18,12 @@ float UPEVM_AttributeLeveling::GetExperiencePercent() const
 	return CurrentExperience / RequiredExperience;
 }
 
-void UPEVM_AttributeLeveling::OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData)
+void UPEVM_AttributeLeveling::OnFieldsChanged(const uint32 ChangedFields)
 {
-	Super::OnAttributeChange(AttributeChangeData);
+	Super::OnFieldsChanged(ChangedFields);
 
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPELevelingAS, CurrentLevel);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPELevelingAS, CurrentExperience);
-	CHECK_ATTRIBUTE_AND_SET_VALUE(UPELevelingAS, RequiredExperience);
+	// All fields of this view model are used by the experience percent: broadcast it once after all changes of the frame were applied
+	UE_MVVM_BROADCAST_FIELD_VALUE_CHANGED(GetExperiencePercent);
 }
 
 void UPEVM_AttributeLeveling::SetCurrentLevel(const float InValue)
@@ -19,6 +19,7 @@ class UInputAction;
 class USpringArmComponent;
 class UCameraComponent;
 class UPEInventoryComponent;
+class UPECameraOffsetComponent;
 
 /**
  *
@@ -34,6 +35,9 @@ class PROJECTELEMENTUS_API APECharacter final : public ACharacter, public IAbili
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<UCameraComponent> FollowCamera;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UPECameraOffsetComponent> CameraOffset;
+
 protected:	
 	virtual void PossessedBy(AController* InController) override;
 	virtual void OnRep_PlayerState() override;
@@ -61,6 +65,12 @@ public:
 	{
 		return FollowCamera;
 	}
+
+	/** Returns CameraOffset sub object **/
+	FORCEINLINE UPECameraOffsetComponent* GetCameraOffset() const
+	{
+		return CameraOffset;
+	}
 		
 	/** Returns FollowCamera default/initial relative location **/
 	static FVector GetCameraDefaultPosition();
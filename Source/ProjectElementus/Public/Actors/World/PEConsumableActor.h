@@ -28,6 +28,9 @@ public:
 	bool bDestroyAfterConsumption;
 
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
 	void PerformConsumption(class UAbilitySystemComponent* TargetABSC);
 
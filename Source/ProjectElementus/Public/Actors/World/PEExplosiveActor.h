@@ -43,5 +43,5 @@ protected:
 	TArray<TObjectPtr<UNiagaraSystem>> ExplosionVFXs;
 
 private:
-	void ApplyExplosibleEffect(UAbilitySystemComponent* TargetABSC);
+	void ApplyExplosibleEffect(const TArrayView<UAbilitySystemComponent* const> TargetABSCs);
 };
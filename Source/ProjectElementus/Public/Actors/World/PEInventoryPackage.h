@@ -24,6 +24,8 @@ public:
 	TObjectPtr<UStaticMeshComponent> PackageMesh;
 
 protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaSeconds) override;
 
 	virtual bool IsInteractEnabled_Implementation() const override;
@@ -0,0 +1,77 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Components/ActorComponent.h>
+#include "PECameraOffsetComponent.generated.h"
+
+class UCameraComponent;
+
+/* Called when a request finishes blending: bReverted is true when the request blended back and was removed */
+DECLARE_DELEGATE_OneParam(FPECameraOffsetBlendFinished, const bool /*bReverted*/);
+
+/**
+ * Blends the owner camera relative location between stacked offset requests in a single tick
+ * Requests are plain entries sorted by priority: Each one blends from the location resolved by the lower priorities to its target location
+ * The component only ticks while there are requests blending
+ */
+UCLASS(Blueprintable, ClassGroup = (Custom), Category = "Project Elementus | Classes", EditInlineNew, meta = (BlueprintSpawnableComponent))
+class PROJECTELEMENTUS_API UPECameraOffsetComponent final : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	explicit UPECameraOffsetComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	/* Start blending the camera to the given relative location. Returns the handle of the request, or INDEX_NONE if there's no camera to move */
+	int32 AddOffsetRequest(const FVector& InTargetLocation, const float InBlendTime, const int32 InPriority, FPECameraOffsetBlendFinished&& InOnBlendFinished);
+
+	/* Blend the request back. The request is removed when the reversion completes */
+	bool RevertOffsetRequest(const int32 InHandle);
+
+	/* Blend the request back without notifying its owner */
+	void ReleaseOffsetRequest(const int32 InHandle);
+
+	bool IsValidOffsetRequest(const int32 InHandle) const;
+
+	/* Camera relative location without any request applied */
+	const FVector& GetBaseLocation() const;
+
+	/* Current camera relative location */
+	FVector GetCurrentLocation() const;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+protected:
+	virtual void BeginPlay() override;
+
+private:
+	struct FOffsetRequest
+	{
+		int32 Handle = INDEX_NONE;
+		int32 Priority = 0;
+
+		FVector TargetLocation = FVector::ZeroVector;
+		float BlendTime = 0.f;
+		float Alpha = 0.f;
+
+		bool bReverting = false;
+		bool bNotifiedMove = false;
+
+		FPECameraOffsetBlendFinished OnBlendFinished;
+	};
+
+	FOffsetRequest* FindRequest(const int32 InHandle);
+	const FOffsetRequest* FindRequest(const int32 InHandle) const;
+
+	/* Sorted by ascending priority: Requests with the same priority keep their insertion order */
+	TArray<FOffsetRequest> Requests;
+
+	TWeakObjectPtr<UCameraComponent> TargetCamera;
+	FVector BaseLocation = FVector::ZeroVector;
+
+	int32 NextHandle = 0;
+};
@@ -7,14 +7,61 @@
 #include <CoreMinimal.h>
 #include <AbilitySystemComponent.h>
 #include <AttributeSet.h>
+#include <Engine/NetSerialization.h>
 #include "PEAttributeBase.generated.h"
 
+class UPEAttributeBase;
+
 #define ATTRIBUTE_ACCESSORS(ClassName, PropertyName) \
 			GAMEPLAYATTRIBUTE_PROPERTY_GETTER(ClassName, PropertyName) \
 			GAMEPLAYATTRIBUTE_VALUE_GETTER(PropertyName) \
 			GAMEPLAYATTRIBUTE_VALUE_SETTER(PropertyName) \
 			GAMEPLAYATTRIBUTE_VALUE_INITTER(PropertyName)
 
+/* Register the replication of an attribute according to the attribute replication mode */
+#define DOREPLIFETIME_ATTRIBUTE(ClassName, PropertyName) \
+			if (IsUsingQuantizedReplication()) \
+			{ \
+				DISABLE_REPLICATED_PROPERTY(ClassName, PropertyName); \
+			} \
+			else \
+			{ \
+				DOREPLIFETIME_CONDITION_NOTIFY(ClassName, PropertyName, COND_None, REPNOTIFY_Always); \
+			}
+
+/* An attribute replicated by the quantized replication mode and the precision used to quantize its base and current values */
+struct FPEQuantizedAttribute
+{
+	FGameplayAttribute Attribute;
+	float Precision = 0.1f;
+};
+
+/* Quantized base and current values of an attribute set. Each connection receives a dirty mask followed by the attributes that changed since its last update */
+USTRUCT()
+struct PROJECTELEMENTUS_API FPEQuantizedAttributeState
+{
+	GENERATED_BODY()
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams);
+
+private:
+	friend class UPEAttributeBase;
+
+	/* Base and current value pairs in the order of the owner's quantized attributes */
+	TArray<int32> Values;
+
+	UPEAttributeBase* Owner = nullptr;
+};
+
+template<>
+struct TStructOpsTypeTraits<FPEQuantizedAttributeState> : TStructOpsTypeTraitsBase2<FPEQuantizedAttributeState>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
 /**
  *
  */
@@ -26,7 +73,16 @@ class PROJECTELEMENTUS_API UPEAttributeBase : public UAttributeSet
 public:
 	explicit UPEAttributeBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	virtual void PostInitProperties() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/* Check if the attribute sets are replicated with quantized values instead of full attribute data */
+	static bool IsUsingQuantizedReplication();
+
 protected:
+	/* Attributes replicated by the quantized replication mode. Limited to 32 attributes per set */
+	virtual TArrayView<const FPEQuantizedAttribute> GetQuantizedAttributes() const;
+
 	/* A helper function to clamp attribute values */
 	virtual void AdjustAttributeForMaxChange(const FGameplayAttributeData& AffectedAttribute, const FGameplayAttributeData& MaxAttribute, float NewMaxValue, const FGameplayAttribute& AffectedAttributeProperty) const;
 
@@ -37,4 +93,13 @@ protected:
 	{
 		return Cast<ComponentTy>(GetOwningAbilitySystemComponent());
 	}
+
+private:
+	friend struct FPEQuantizedAttributeState;
+
+	void QuantizeAttributes(TArray<int32>& OutValues);
+	void ApplyQuantizedAttributes(const TArray<int32>& InValues, const uint32 InMask);
+
+	UPROPERTY(Replicated)
+	FPEQuantizedAttributeState QuantizedAttributes;
 };
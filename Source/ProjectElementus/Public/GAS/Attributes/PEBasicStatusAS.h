@@ -24,6 +24,7 @@ private:
 	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual TArrayView<const FPEQuantizedAttribute> GetQuantizedAttributes() const override;
 
 public:
 	/* A non-replicated attribute to handle damage value inside GE Executions */
@@ -22,6 +22,7 @@ public:
 private:
 	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual TArrayView<const FPEQuantizedAttribute> GetQuantizedAttributes() const override;
 
 public:
 	UPROPERTY(BlueprintReadOnly, Category = "Project Elementus | Properties", ReplicatedUsing = OnRep_AttackRate)
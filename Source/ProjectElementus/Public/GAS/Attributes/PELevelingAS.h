@@ -6,6 +6,7 @@
 
 #include <CoreMinimal.h>
 #include "GAS/Attributes/PEAttributeBase.h"
+#include "GAS/System/PEAttributeData.h"
 #include "PELevelingAS.generated.h"
 
 /**
@@ -19,11 +20,19 @@ class PROJECTELEMENTUS_API UPELevelingAS final : public UPEAttributeBase
 public:
 	explicit UPELevelingAS(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	/* Flatten the leveling bonus rows into a array indexed by level: The element N is the row used to reach the level N */
+	static void BuildLevelingTable(const UDataTable* InTable, TArray<FPELevelingData>& OutLevelingTable);
+
 private:
 	TSoftObjectPtr<UDataTable> LevelingBonusData;
 
+	/* Preloaded leveling rows shared between all instances */
+	TSharedPtr<const TArray<FPELevelingData>> LevelingTable;
+
+	virtual void PostInitProperties() override;
 	virtual void PostAttributeChange(const FGameplayAttribute& Attribute, float OldValue, float NewValue) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual TArrayView<const FPEQuantizedAttribute> GetQuantizedAttributes() const override;
 
 public:
 	UPROPERTY(BlueprintReadOnly, Category = "Project Elementus | Properties", ReplicatedUsing = OnRep_CurrentLevel)
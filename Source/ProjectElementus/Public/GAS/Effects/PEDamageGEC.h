@@ -8,6 +8,8 @@
 #include <GameplayEffectExecutionCalculation.h>
 #include "PEDamageGEC.generated.h"
 
+class UAbilitySystemComponent;
+
 /**
  *
  */
@@ -20,4 +22,10 @@ public:
 	explicit UPEDamageGEC(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, OUT FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const override;
+
+	/* Calculate the damage of multiple targets at once: The arrays must have the same size and each random value is taken from a stream initialized with the seed of its target. DefenseRate is clamped to a small positive value */
+	static void CalculateDamageBatch(TArrayView<const float> BaseDamage, TArrayView<const float> AttackRate, TArrayView<const float> DefenseRate, TArrayView<const int32> Seeds, TArrayView<float> OutDamage);
+
+	/* Seed of the target random stream: Combines the effect, level, instigator, the random seed of the effect context and the target */
+	static int32 MakeDamageSeed(const FGameplayEffectSpec& Spec, const UAbilitySystemComponent* Target);
 };
@@ -7,6 +7,7 @@
 #include <CoreMinimal.h>
 #include <Kismet/BlueprintFunctionLibrary.h>
 #include "GAS/System/PETrace.h"
+#include "GAS/System/PEEffectData.h"
 #include "PEAbilityFunctions.generated.h"
 
 /**
@@ -26,6 +27,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Project Elementus | Functions")
 	static FGameplayAbilityTargetDataHandle MakeTargetDataHandleFromHitResultArray(const TArray<FHitResult> HitResults);
 
+	/* Create a FGameplayAbilityTargetDataHandle with a single FPEGameplayAbilityTargetData_MultiHit entry containing all the HitResults
+	 * Cheaper to build and replicate than an entry per hit, but index based hit result accessors will only see the first hit */
+	UFUNCTION(BlueprintPure, Category = "Project Elementus | Functions")
+	static FGameplayAbilityTargetDataHandle MakeMultiHitTargetDataHandleFromHitResultArray(const TArray<FHitResult> HitResults);
+
 	/* Create a FGameplayAbilityTargetDataHandle with the specified Target Actors */
 	UFUNCTION(BlueprintPure, Category = "Project Elementus | Functions")
 	static FGameplayAbilityTargetDataHandle MakeTargetDataHandleFromActorArray(const TArray<AActor*> TargetActors);
@@ -46,4 +52,12 @@ public:
 	/* Will remove the ability associated to the InputAction */
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
 	static void RemoveAbility(UAbilitySystemComponent* TargetABSC, const TSubclassOf<UGameplayAbility> Ability);
+
+	/* Add or change a Set by Caller magnitude of the grouped effect data, keeping its runtime data up to date */
+	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
+	static void SetEffectSetByCallerMagnitude(UPARAM(ref) FGameplayEffectGroupedData& GroupedData, const FGameplayTag Tag, const float Magnitude);
+
+	/* Remove a Set by Caller magnitude of the grouped effect data, keeping its runtime data up to date */
+	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
+	static void RemoveEffectSetByCallerMagnitude(UPARAM(ref) FGameplayEffectGroupedData& GroupedData, const FGameplayTag Tag);
 };
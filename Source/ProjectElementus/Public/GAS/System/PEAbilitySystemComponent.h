@@ -6,13 +6,87 @@
 
 #include <CoreMinimal.h>
 #include <AbilitySystemComponent.h>
+#include <UObject/ObjectKey.h>
+#include "GAS/System/PEEffectData.h"
 #include "PEAbilitySystemComponent.generated.h"
 
-struct FGameplayEffectGroupedData;
+class UPEGameplayAbility;
+class AGameplayAbilityTargetActor;
 class UPEVM_AttributeBasic;
 class UPEVM_AttributeCustom;
 class UPEVM_AttributeLeveling;
 
+/*
+* Identity of an active effect: used to find effects applied with grouped GE data without iterating all active effects
+* Set by Caller values are not part of the key: the grouped data only needs to match a subset of the effect values
+*/
+struct FPEActiveEffectIndexKey
+{
+	FPEActiveEffectIndexKey() = default;
+
+	FPEActiveEffectIndexKey(const UClass* InEffectClass, const UAbilitySystemComponent* InInstigator) : EffectClass(InEffectClass), Instigator(InInstigator)
+	{
+	}
+
+	TObjectKey<UClass> EffectClass;
+	TObjectKey<UAbilitySystemComponent> Instigator;
+
+	bool operator==(const FPEActiveEffectIndexKey& Other) const
+	{
+		return EffectClass == Other.EffectClass && Instigator == Other.Instigator;
+	}
+
+	friend uint32 GetTypeHash(const FPEActiveEffectIndexKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.EffectClass), GetTypeHash(Key.Instigator));
+	}
+};
+
+/* Identity of a cached effect spec template: the effect class, the spec level and the exact Set by Caller values */
+struct FPEEffectSpecTemplateKey
+{
+	FPEEffectSpecTemplateKey() = default;
+
+	FPEEffectSpecTemplateKey(const UClass* InEffectClass, const float InLevel, const FPESetByCallerData& InSetByCallerData) : EffectClass(InEffectClass), Level(InLevel), SetByCallerData(InSetByCallerData)
+	{
+	}
+
+	TObjectKey<UClass> EffectClass;
+	float Level = 1.f;
+
+	/* Sorted by tag, as returned by FGameplayEffectGroupedData::GetSetByCallerData */
+	FPESetByCallerData SetByCallerData;
+
+	bool operator==(const FPEEffectSpecTemplateKey& Other) const
+	{
+		if (EffectClass != Other.EffectClass || Level != Other.Level || SetByCallerData.Num() != Other.SetByCallerData.Num())
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < SetByCallerData.Num(); ++Index)
+		{
+			if (SetByCallerData[Index].Key != Other.SetByCallerData[Index].Key || SetByCallerData[Index].Value != Other.SetByCallerData[Index].Value)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	friend uint32 GetTypeHash(const FPEEffectSpecTemplateKey& Key)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Key.EffectClass), GetTypeHash(Key.Level));
+		for (const TPair<FGameplayTag, float>& StackedData : Key.SetByCallerData)
+		{
+			Hash = HashCombine(Hash, HashCombine(GetTypeHash(StackedData.Key), GetTypeHash(StackedData.Value)));
+		}
+
+		return Hash;
+	}
+};
+
 /**
  *
  */
@@ -24,19 +98,27 @@ class PROJECTELEMENTUS_API UPEAbilitySystemComponent final : public UAbilitySyst
 public:
 	explicit UPEAbilitySystemComponent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	virtual FActiveGameplayEffectHandle ApplyGameplayEffectSpecToSelf(const FGameplayEffectSpec& GameplayEffect, FPredictionKey PredictionKey = FPredictionKey()) override;
+
 	/* Apply a grouped GE data to self Ability System Component */
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
-	void ApplyEffectGroupedDataToSelf(const FGameplayEffectGroupedData GroupedData);
+	void ApplyEffectGroupedDataToSelf(const FGameplayEffectGroupedData& GroupedData);
 
 	/* Apply a grouped GE data to target Ability System Component */
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
-	void ApplyEffectGroupedDataToTarget(const FGameplayEffectGroupedData GroupedData, UAbilitySystemComponent* TargetABSC);
+	void ApplyEffectGroupedDataToTarget(const FGameplayEffectGroupedData& GroupedData, UAbilitySystemComponent* TargetABSC);
+
+	/*
+	* Apply grouped GE data to multiple targets in a single pass. Duplicated and invalid targets are ignored
+	* With a valid instigator, each spec is built once and shared by all targets. Otherwise, each target will apply the effects to itself
+	*/
+	static void ApplyEffectGroupedDataToTargets(const TArrayView<const FGameplayEffectGroupedData> GroupedData, const TArrayView<UAbilitySystemComponent* const> TargetABSCs, UPEAbilitySystemComponent* InstigatorABSC = nullptr);
 
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
-	void RemoveEffectGroupedDataFromSelf(const FGameplayEffectGroupedData GroupedData, UAbilitySystemComponent* InstigatorABSC, const int32 StacksToRemove = 1);
+	void RemoveEffectGroupedDataFromSelf(const FGameplayEffectGroupedData& GroupedData, UAbilitySystemComponent* InstigatorABSC, const int32 StacksToRemove = 1);
 
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
-	void RemoveEffectGroupedDataFromTarget(const FGameplayEffectGroupedData GroupedData, UAbilitySystemComponent* InstigatorABSC, UAbilitySystemComponent* TargetABSC, const int32 StacksToRemove = 1);
+	void RemoveEffectGroupedDataFromTarget(const FGameplayEffectGroupedData& GroupedData, UAbilitySystemComponent* InstigatorABSC, UAbilitySystemComponent* TargetABSC, const int32 StacksToRemove = 1);
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Project Elementus | Properties")
 	TObjectPtr<UPEVM_AttributeBasic> BasicAttributes_VM;
@@ -49,10 +131,53 @@ public:
 	
 	virtual void InitAbilityActorInfo(AActor* InOwnerActor, AActor* InAvatarActor) override;
 
+	/* Register an active ability to be ended when one of its profile interrupt tags is added */
+	void RegisterInterruptibleAbility(UPEGameplayAbility* Ability);
+
+	void UnregisterInterruptibleAbility(UPEGameplayAbility* Ability);
+
+	/* Get a parked targeting actor of the given class from the pool. Returns nullptr if there's no actor available */
+	AGameplayAbilityTargetActor* AcquirePooledTargetActor(const UClass* TargetActorClass);
+
+	/* Park a targeting actor implementing IPEPooledTargetActor to be reused. Returns false if it can't be pooled, the caller must destroy it */
+	bool ReleasePooledTargetActor(AGameplayAbilityTargetActor* TargetActor);
+
+	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	virtual void InitializeAttributeViewModel(const UAttributeSet* AttributeClass);
 
 private:
-	void InitializeBasicAttributesViewModel(const class UPEBasicStatusAS* Attribute);
-	void InitializeCustomAttributesViewModel(const class UPECustomStatusAS* Attribute);
-	void InitializeLevelingAttributesViewModel(const class UPELevelingAS* Attribute);
+	/* Get the cached spec built with the given grouped data or create a new one. Applications must copy the returned spec */
+	const FGameplayEffectSpec* FindOrAddEffectSpecTemplate(const FGameplayEffectGroupedData& GroupedData);
+
+	/* Remove the indexed active effects that matches the given grouped data */
+	void RemoveIndexedEffectGroupedData(const FGameplayEffectGroupedData& GroupedData, const UAbilitySystemComponent* InstigatorABSC, const int32 StacksToRemove);
+
+	void OnInterruptTagChanged_Callback(const FGameplayTag InterruptTag, const int32 NewCount);
+
+	/* Active abilities that will be ended when one of their interrupt tags is added */
+	TArray<TWeakObjectPtr<UPEGameplayAbility>> InterruptibleAbilities;
+
+	/* Tags with a tag event already bound to OnInterruptTagChanged_Callback */
+	FGameplayTagContainer RegisteredInterruptTags;
+
+	void IndexActiveEffect(const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+
+	void OnActiveEffectAdded_Callback(UAbilitySystemComponent* SourceABSC, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void OnActiveEffectRemoved_Callback(const FActiveGameplayEffect& Effect);
+
+	/* Active effect handles indexed by effect class and instigator. Only maintained with authority */
+	TMultiMap<FPEActiveEffectIndexKey, FActiveGameplayEffectHandle> ActiveEffectIndex;
+
+	/* Reverse lookup used to update ActiveEffectIndex when an effect is removed */
+	TMap<FActiveGameplayEffectHandle, FPEActiveEffectIndexKey> ActiveEffectIndexKeys;
+
+	/* Parked targeting actors waiting to be reused */
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<AGameplayAbilityTargetActor>> PooledTargetActors;
+
+	/* Pre-built specs with the Set by Caller parameters already applied. Bounded: the cache is flushed when full */
+	TMap<FPEEffectSpecTemplateKey, FGameplayEffectSpec> EffectSpecTemplates;
 };
@@ -0,0 +1,22 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <AbilitySystemGlobals.h>
+#include "PEAbilitySystemGlobals.generated.h"
+
+/**
+ *
+ */
+UCLASS(NotBlueprintable, Category = "Project Elementus | Classes")
+class PROJECTELEMENTUS_API UPEAbilitySystemGlobals final : public UAbilitySystemGlobals
+{
+	GENERATED_BODY()
+
+public:
+	/* Effects use FPEGameplayEffectContext: Each application gets its own random seed */
+	virtual FGameplayEffectContext* AllocGameplayEffectContext() const override;
+};
@@ -0,0 +1,44 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <GameplayEffectTypes.h>
+#include "PEEffectContext.generated.h"
+
+/**
+ * Effect context created by UPEAbilitySystemGlobals: Adds a random seed to each application
+ * The seed is replicated with the context, so the server and the clients use the same random values
+ */
+USTRUCT(BlueprintType, Category = "Project Elementus | Structs")
+struct PROJECTELEMENTUS_API FPEGameplayEffectContext : public FGameplayEffectContext
+{
+	GENERATED_USTRUCT_BODY()
+
+	FPEGameplayEffectContext();
+	FPEGameplayEffectContext(AActor* InInstigator, AActor* InEffectCauser);
+
+	int32 GetRandomSeed() const;
+
+	virtual UScriptStruct* GetScriptStruct() const override;
+	virtual FGameplayEffectContext* Duplicate() const override;
+	virtual bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) override;
+
+	/* Get the seed of a context handle. Returns 0 if the context wasn't created by UPEAbilitySystemGlobals */
+	static int32 GetRandomSeed(const FGameplayEffectContextHandle& InContext);
+
+private:
+	int32 RandomSeed;
+};
+
+template <>
+struct TStructOpsTypeTraits<FPEGameplayEffectContext> : TStructOpsTypeTraitsBase2<FPEGameplayEffectContext>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithCopy = true
+	};
+};
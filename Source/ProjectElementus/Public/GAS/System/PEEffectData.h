@@ -10,19 +10,76 @@
 
 class UGameplayEffect;
 
+/* Runtime representation of the Set by Caller parameters: valid tags only, sorted by tag */
+using FPESetByCallerData = TArray<TPair<FGameplayTag, float>, TInlineAllocator<4>>;
+
 /**
  *
  */
 USTRUCT(BlueprintType, Category = "Project Elementus | Structs")
-struct FGameplayEffectGroupedData
+struct PROJECTELEMENTUS_API FGameplayEffectGroupedData
 {
 	GENERATED_USTRUCT_BODY()
 
 	FGameplayEffectGroupedData() = default;
 
+	/* Copies rebuild their runtime data on first use: the copied map can be changed before it is used */
+	FGameplayEffectGroupedData(const FGameplayEffectGroupedData& Other);
+	FGameplayEffectGroupedData& operator=(const FGameplayEffectGroupedData& Other);
+
+	/* Moves keep the runtime data: it still matches the moved map */
+	FGameplayEffectGroupedData(FGameplayEffectGroupedData&& Other) noexcept;
+	FGameplayEffectGroupedData& operator=(FGameplayEffectGroupedData&& Other) noexcept;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Project Elementus | Properties")
 	TSubclassOf<UGameplayEffect> EffectClass;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Project Elementus | Properties")
+	/* Source of the runtime data: Use SetSetByCallerMagnitude/RemoveSetByCallerMagnitude (SetEffectSetByCallerMagnitude/RemoveEffectSetByCallerMagnitude in Blueprints), or call InvalidateSetByCallerData after changing it directly */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Project Elementus | Properties")
 	TMap<FGameplayTag, float> SetByCallerStackedData;
-};
\ No newline at end of file
+
+	void SetSetByCallerMagnitude(const FGameplayTag& InTag, const float InValue);
+	void RemoveSetByCallerMagnitude(const FGameplayTag& InTag);
+
+	/* Runtime data will be rebuilt on next use */
+	void InvalidateSetByCallerData() const;
+
+	/* Get the sorted Set by Caller parameters, built from SetByCallerStackedData on load or on first use */
+	const FPESetByCallerData& GetSetByCallerData() const;
+
+	/* Get the order independent hash of the Set by Caller parameters */
+	uint32 GetSetByCallerSignature() const;
+
+	/* Make the same signature returned by GetSetByCallerSignature with the given Set by Caller map */
+	static uint32 MakeSetByCallerSignature(const TMap<FGameplayTag, float>& SetByCallerData);
+
+	void PostSerialize(const FArchive& Ar);
+
+	bool operator==(const FGameplayEffectGroupedData& Other) const;
+
+	bool operator!=(const FGameplayEffectGroupedData& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	friend uint32 GetTypeHash(const FGameplayEffectGroupedData& GroupedData)
+	{
+		return HashCombine(GetTypeHash(GroupedData.EffectClass.Get()), GroupedData.GetSetByCallerSignature());
+	}
+
+private:
+	void UpdateSetByCallerData() const;
+
+	mutable FPESetByCallerData SetByCallerData;
+	mutable uint32 SetByCallerSignature = 0u;
+	mutable bool bSetByCallerDataUpdated = false;
+};
+
+template<>
+struct TStructOpsTypeTraits<FGameplayEffectGroupedData> : public TStructOpsTypeTraitsBase2<FGameplayEffectGroupedData>
+{
+	enum
+	{
+		WithPostSerialize = true,
+	};
+};
@@ -0,0 +1,94 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "Management/ProjectElementus.h"
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS PreActivate"), STAT_PEGAS_PreActivate, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS ActivateAbility"), STAT_PEGAS_ActivateAbility, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS EndAbility"), STAT_PEGAS_EndAbility, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS CheckCost"), STAT_PEGAS_CheckCost, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS ApplyCost"), STAT_PEGAS_ApplyCost, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS CheckCooldown"), STAT_PEGAS_CheckCooldown, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS ApplyCooldown"), STAT_PEGAS_ApplyCooldown, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS ApplyEffectSpec"), STAT_PEGAS_ApplyEffectSpec, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS ApplyEffectGroupedData"), STAT_PEGAS_ApplyEffectGroupedData, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS RemoveEffectGroupedData"), STAT_PEGAS_RemoveEffectGroupedData, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS PreAttributeChange"), STAT_PEGAS_PreAttributeChange, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS PostAttributeChange"), STAT_PEGAS_PostAttributeChange, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("GAS PostGameplayEffectExecute"), STAT_PEGAS_PostGameplayEffectExecute, STATGROUP_ProjectElementus, PROJECTELEMENTUS_API);
+
+/* GAS entry points measured by FPEGASProfiler */
+enum class EPEGASProfileScope : uint8
+{
+	PreActivate,
+	ActivateAbility,
+	EndAbility,
+	CheckCost,
+	ApplyCost,
+	CheckCooldown,
+	ApplyCooldown,
+	ApplyEffectSpec,
+	ApplyEffectGroupedData,
+	RemoveEffectGroupedData,
+	PreAttributeChange,
+	PostAttributeChange,
+	PostGameplayEffectExecute,
+
+	MAX
+};
+
+/**
+ * Per class timings of the GAS entry points, kept in every build configuration (including shipping dedicated servers)
+ * Each measure costs two cycle reads and a map lookup on the game thread. Controlled by PE.GAS.Profiling and dumped with PE.GAS.DumpProfile
+ */
+class PROJECTELEMENTUS_API FPEGASProfiler
+{
+public:
+	static bool IsEnabled();
+
+	/* Start a measure of the scope. Returns false if disabled or if the scope is already being measured (e.g. Super calls of instrumented overrides) */
+	static bool BeginScope(const EPEGASProfileScope InScope);
+
+	/* Finish a measure started by BeginScope and accumulate it for the given context class (ability, effect or attribute set). Also recorded as CSV custom stats per scope and per class */
+	static void EndScope(const EPEGASProfileScope InScope, const UClass* InContextClass, const uint64 InCycles);
+
+	static void Dump(FOutputDevice& Ar);
+	static void Reset();
+
+	static const TCHAR* GetScopeName(const EPEGASProfileScope InScope);
+
+private:
+	/* Scopes being measured on the game thread */
+	static uint32 ActiveScopes;
+};
+
+/* Measure the lifetime of the scope and record it in FPEGASProfiler */
+class FPEGASProfileScope
+{
+public:
+	FPEGASProfileScope(const EPEGASProfileScope InScope, const UClass* InContextClass) : Scope(InScope), ContextClass(InContextClass), StartCycles(FPEGASProfiler::BeginScope(InScope) ? FPlatformTime::Cycles64() : 0u)
+	{
+	}
+
+	~FPEGASProfileScope()
+	{
+		if (StartCycles != 0u)
+		{
+			FPEGASProfiler::EndScope(Scope, ContextClass, FPlatformTime::Cycles64() - StartCycles);
+		}
+	}
+
+private:
+	const EPEGASProfileScope Scope;
+	const UClass* const ContextClass;
+	const uint64 StartCycles;
+};
+
+/* Instrument a GAS entry point with a cycle counter and a per class measure (also recorded in the ProjectElementus CSV category) */
+#define PE_GAS_PROFILE_SCOPE(ScopeName, ContextClass) \
+			SCOPE_CYCLE_COUNTER(STAT_PEGAS_##ScopeName); \
+			const FPEGASProfileScope PEGASProfileScope_##ScopeName(EPEGASProfileScope::ScopeName, ContextClass)
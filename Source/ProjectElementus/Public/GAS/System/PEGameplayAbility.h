@@ -6,7 +6,9 @@
 
 #include <CoreMinimal.h>
 #include <Abilities/GameplayAbility.h>
+#include <GameplayEffect.h>
 #include "GAS/System/PEEffectData.h"
+#include "Management/Subsystems/PETimingWheelSubsystem.h"
 #include "PEGameplayAbility.generated.h"
 
 class AGameplayAbilityTargetActor_Trace;
@@ -34,6 +36,48 @@ struct FPEAudioData
 	float StartTime = 0.f;
 };
 
+/* Additive modifier of the cost effect resolved with the ability Set by Caller parameters */
+struct FPECostModifierData
+{
+	FGameplayAttribute Attribute;
+
+	/* Used to evaluate scalable float magnitudes with the ability level */
+	FGameplayEffectModifierMagnitude Magnitude;
+
+	/* Value found in the ability Set by Caller parameters */
+	float SetByCallerMagnitude = 0.f;
+
+	bool bIsSetByCaller = false;
+};
+
+/**
+ * Activation data resolved once from the class default object and shared by all instances of the same ability class
+ * Cost and cooldown specs are not stored: They capture the owner attributes and context, so only their Set by Caller parameters are resolved here
+ */
+struct FPEAbilityActivationProfile
+{
+	/* Cooldown tags used to check and grant the cooldown, without the generic cooldown tag */
+	FGameplayTagContainer CooldownTags;
+
+	/* Tags that will end the ability when added to the owner */
+	FGameplayTagContainer InterruptTags;
+
+	/* Valid Set by Caller parameters of the cost effect */
+	TArray<TPair<FGameplayTag, float>> CostSetByCallerData;
+
+	/* Valid Set by Caller parameters of the cooldown effect */
+	TArray<TPair<FGameplayTag, float>> CooldownSetByCallerData;
+
+	/* Additive modifiers checked by CheckCost without creating an effect spec */
+	TArray<FPECostModifierData> CostModifiers;
+
+	/* False if the cost effect has modifiers that can only be evaluated with an effect spec */
+	bool bCostModifiersResolved = false;
+
+	bool bUseSetByCallerCost = false;
+	bool bUseSetByCallerCooldown = false;
+};
+
 /**
  *
  */
@@ -57,6 +101,12 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Project Elementus | Properties")
 	bool bIgnoreCooldown;
 
+	/* Get the activation profile of this ability class, building it from the class default object on first use */
+	const FPEAbilityActivationProfile& GetActivationProfile() const;
+
+	/* End this ability if active: called by the owner when one of the profile interrupt tags is added */
+	void InterruptAbility();
+
 protected:
 	/* If true, ability will wait for Cancel Input to cancel this ability */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Project Elementus | Properties")
@@ -113,6 +163,15 @@ private:
 	UFUNCTION(Category = "Project Elementus | Functions | Callbacks")
 	void WaitCancelInput_Callback();
 
+	/* Build the activation profile with the current values of this object */
+	TSharedRef<const FPEAbilityActivationProfile> BuildActivationProfile() const;
+
+	/* Shared with the class default object: must be considered immutable after creation */
+	mutable TSharedPtr<const FPEAbilityActivationProfile> ActivationProfile;
+
+	/* Set once AbilityTags were appended to ActivationBlockedTags in PreActivate, so the append happens only once per ability object. Not related to ActivationProfile */
+	bool bAbilityTagsAddedToBlockedTags;
+
 protected:
 	virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override final;
 
@@ -143,6 +202,13 @@ protected:
 	/* Apply Set by Caller data map to the given Gameplay Effect Spec */
 	void ApplySetByCallerParamsToEffectSpec(const TMap<FGameplayTag, float>& SetByCallerData, const TSharedPtr<FGameplayEffectSpec>& EffectSpec) const;
 
+	/* Apply resolved Set by Caller data to the given Gameplay Effect Spec */
+	void ApplySetByCallerParamsToEffectSpec(const TArrayView<const TPair<FGameplayTag, float>> SetByCallerData, const TSharedPtr<FGameplayEffectSpec>& EffectSpec) const;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif WITH_EDITOR
+
 	/*
 	* These 'Activate Task' and 'Callback' functions are intended to act as helper functions
 	* They will call the defaults tasks from original GAS source
@@ -264,6 +330,10 @@ protected:
 
 	void ApplyAbilityEffectsToTarget(const FGameplayAbilityTargetDataHandle TargetDataHandle, const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo);
 
+	/* Apply TargetAbilityEffects to all hit targets, packed in a single multi hit target data. Used by area of effect hits that don't need index based hit results */
+	UFUNCTION(BlueprintCallable, DisplayName = "ApplyAbilityEffectsToHitResults", Category = "Project Elementus | Functions")
+	void BP_ApplyAbilityEffectsToHitResults(const TArray<FHitResult>& HitResults);
+
 	/* Spawn and fire a projectile with TargetAbilityEffects effects applied */
 	UFUNCTION(BlueprintCallable, DisplayName = "SpawnProjectileWithTargetEffects", Category = "Project Elementus | Functions")
 	void BP_SpawnProjectileWithTargetEffects(const TSubclassOf<APEProjectileActor> ProjectileClass, const FTransform ProjectileTransform, const FVector ProjectileFireDirection);
@@ -288,8 +358,14 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
 	void PlayAbilitySoundAtLocation(const UObject* WorldContext, const FVector InLocation = FVector::ZeroVector);
 	
-	/* Shared Timer Handle that is actually used with bEndAbilityAfterActiveTime */
-	FTimerHandle CancelationTimerHandle;
+	/* Schedule this ability to end after InTime seconds, replacing any pending schedule */
+	void ScheduleEndAbility(const float InTime);
+
+	/* Cancel the pending end schedule, if any */
+	void ClearEndAbilitySchedule();
+
+	/* Shared handle that is actually used with bEndAbilityAfterActiveTime */
+	FPETimingWheelHandle CancelationTimerHandle;
 
 	/* Extra tags to manage tasks conditions */
 	FGameplayTagContainer AbilityExtraTags;
@@ -0,0 +1,31 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "GAS/Targeting/PEGroundTargeting.h"
+#include "GAS/Targeting/PEAsyncTargetingTrace.h"
+#include "PEAsyncGroundTargeting.generated.h"
+
+/**
+ * Ground targeting with asynchronous traces: The aim trace and the downward ground trace are chained, results are delivered a frame later
+ * and confirmation uses the latest completed result. The collision shape adjustment is applied to each result, as the engine's ground trace actor does
+ */
+UCLASS(Blueprintable, Category = "Project Elementus | Classes")
+class PROJECTELEMENTUS_API APEAsyncGroundTargeting : public APEGroundTargeting
+{
+	GENERATED_BODY()
+
+public:
+	explicit APEAsyncGroundTargeting(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void StartTargeting(UGameplayAbility* Ability) override;
+
+protected:
+	virtual FHitResult PerformTrace(AActor* InSourceActor) override;
+
+private:
+	FPEAsyncTargetingTrace AsyncTrace;
+};
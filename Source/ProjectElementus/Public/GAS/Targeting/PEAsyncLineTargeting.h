@@ -0,0 +1,30 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include "GAS/Targeting/PELineTargeting.h"
+#include "GAS/Targeting/PEAsyncTargetingTrace.h"
+#include "PEAsyncLineTargeting.generated.h"
+
+/**
+ * Line targeting with asynchronous traces: Results are delivered in the next frame and confirmation uses the latest completed result
+ */
+UCLASS(Blueprintable, Category = "Project Elementus | Classes")
+class PROJECTELEMENTUS_API APEAsyncLineTargeting : public APELineTargeting
+{
+	GENERATED_BODY()
+
+public:
+	explicit APEAsyncLineTargeting(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void StartTargeting(UGameplayAbility* Ability) override;
+
+protected:
+	virtual FHitResult PerformTrace(AActor* InSourceActor) override;
+
+private:
+	FPEAsyncTargetingTrace AsyncTrace;
+};
@@ -0,0 +1,63 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Engine/HitResult.h>
+#include <WorldCollision.h>
+
+class AGameplayAbilityTargetActor_Trace;
+class AGameplayAbilityWorldReticle;
+
+/**
+ * Pipelined asynchronous traces used by the async targeting actors
+ * Each frame requests a camera trace to resolve the aim point and a targeting trace aimed with the latest resolved aim point.
+ * With ground projection enabled, the targeting result is projected to the ground by a chained downward trace, like the engine's ground trace actor does.
+ * Results are delivered in the next frame, so the game thread never blocks on the physics scene while aiming
+ */
+class PROJECTELEMENTUS_API FPEAsyncTargetingTrace
+{
+public:
+	/* Request this frame traces. Only the first request of a frame is issued. A zero shape requests a line trace, otherwise a sweep */
+	void Request(AGameplayAbilityTargetActor_Trace& InTargetActor, const FCollisionShape& InShape);
+
+	bool HasResult() const;
+
+	/* Latest completed targeting result */
+	const FHitResult& GetResult() const;
+
+	void Reset();
+
+	/* Project each targeting result to the ground with a downward line trace starting InHeightOffset above it. Kept by Reset */
+	void SetGroundProjection(const bool bInProjectToGround, const float InHeightOffset);
+
+	/* Same reticle update performed by the engine's trace targeting actors */
+	static void UpdateReticle(AGameplayAbilityWorldReticle* InReticle, const FHitResult& InHitResult);
+
+private:
+	void RequestAimTrace(AGameplayAbilityTargetActor_Trace& InTargetActor, const FCollisionQueryParams& InParams, const FVector& InTraceStart);
+	void RequestGroundTrace(AGameplayAbilityTargetActor_Trace& InTargetActor, const FCollisionQueryParams& InParams, const FHitResult& InTargetResult);
+	FVector ResolveTraceEnd(const AGameplayAbilityTargetActor_Trace& InTargetActor, const FVector& InTraceStart) const;
+
+	static bool FindFirstFilteredHit(const AGameplayAbilityTargetActor_Trace& InTargetActor, const FTraceDatum& InDatum, FHitResult& OutHitResult);
+
+	FTraceHandle AimHandle;
+	FTraceHandle TargetHandle;
+	FTraceHandle GroundHandle;
+
+	FVector ViewStart = FVector::ZeroVector;
+	FVector ViewEnd = FVector::ZeroVector;
+	FVector AimLocation = FVector::ZeroVector;
+
+	FHitResult LatestResult;
+
+	uint64 LastRequestFrame = 0u;
+
+	float GroundHeightOffset = 0.f;
+
+	bool bHasAimLocation = false;
+	bool bHasResult = false;
+	bool bProjectToGround = false;
+};
@@ -6,16 +6,22 @@
 
 #include <CoreMinimal.h>
 #include <Abilities/GameplayAbilityTargetActor_GroundTrace.h>
+#include "GAS/Targeting/PEPooledTargetActor.h"
 #include "PEGroundTargeting.generated.h"
 
 /**
  * 
  */
 UCLASS(Blueprintable, Category = "Project Elementus | Classes")
-class PROJECTELEMENTUS_API APEGroundTargeting : public AGameplayAbilityTargetActor_GroundTrace
+class PROJECTELEMENTUS_API APEGroundTargeting : public AGameplayAbilityTargetActor_GroundTrace, public IPEPooledTargetActor
 {
 	GENERATED_BODY()
 
 public:
 	explicit APEGroundTargeting(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void StartTargeting(UGameplayAbility* Ability) override;
+
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
 };
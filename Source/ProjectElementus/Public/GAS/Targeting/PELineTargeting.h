@@ -6,16 +6,22 @@
 
 #include <CoreMinimal.h>
 #include <Abilities/GameplayAbilityTargetActor_SingleLineTrace.h>
+#include "GAS/Targeting/PEPooledTargetActor.h"
 #include "PELineTargeting.generated.h"
 
 /**
  * 
  */
 UCLASS(Blueprintable, Category = "Project Elementus | Classes")
-class PROJECTELEMENTUS_API APELineTargeting : public AGameplayAbilityTargetActor_SingleLineTrace
+class PROJECTELEMENTUS_API APELineTargeting : public AGameplayAbilityTargetActor_SingleLineTrace, public IPEPooledTargetActor
 {
 	GENERATED_BODY()
 
 public:
 	explicit APELineTargeting(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void StartTargeting(UGameplayAbility* Ability) override;
+
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
 };
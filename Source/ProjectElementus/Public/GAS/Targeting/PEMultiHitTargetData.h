@@ -0,0 +1,78 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Abilities/GameplayAbilityTargetTypes.h>
+#include <Engine/NetSerialization.h>
+#include "PEMultiHitTargetData.generated.h"
+
+/* Compact hit stored by FPEGameplayAbilityTargetData_MultiHit: Only the data sent over the network is kept */
+struct PROJECTELEMENTUS_API FPECompactHitData
+{
+	TWeakObjectPtr<AActor> Actor;
+
+	/* Bone indices are resolved against this component */
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+
+	FVector_NetQuantize TraceStart = FVector::ZeroVector;
+	FVector_NetQuantize ImpactPoint = FVector::ZeroVector;
+	FVector_NetQuantizeNormal ImpactNormal = FVector::ZeroVector;
+	float Distance = 0.f;
+	int32 BoneIndex = INDEX_NONE;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+/**
+ * Target data with any number of hits stored contiguously
+ * Alternative to a FGameplayAbilityTargetData_SingleTargetHit per hit: A single allocation per handle and a compact net serialization
+ * (actor and component references, quantized trace start, impact point and normal, distance, bone index) instead of a full FHitResult per hit
+ * All hits live in a single entry of the handle: Use GetNumHits and GetHitResultAt to access them
+ */
+USTRUCT(BlueprintType, Category = "Project Elementus | Structs")
+struct PROJECTELEMENTUS_API FPEGameplayAbilityTargetData_MultiHit : public FGameplayAbilityTargetData
+{
+	GENERATED_USTRUCT_BODY()
+
+	FPEGameplayAbilityTargetData_MultiHit() = default;
+	explicit FPEGameplayAbilityTargetData_MultiHit(const TArray<FHitResult>& InHitResults);
+
+	void AddHit(const FHitResult& InHitResult);
+
+	int32 GetNumHits() const;
+
+	/* Rebuild the hit result of the given index from the compact data */
+	FHitResult GetHitResultAt(const int32 InIndex) const;
+
+	virtual TArray<TWeakObjectPtr<AActor>> GetActors() const override;
+
+	virtual bool HasEndPoint() const override;
+	virtual FVector GetEndPoint() const override;
+
+	/* Also adds the first hit to the context, as there is no single hit result to return from GetHitResult */
+	virtual void AddTargetDataToContext(FGameplayEffectContextHandle& Context, bool bIncludeActorArray) const override;
+
+	virtual UScriptStruct* GetScriptStruct() const override
+	{
+		return StaticStruct();
+	}
+
+	virtual FString ToString() const override;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+private:
+	TArray<FPECompactHitData> Hits;
+};
+
+template<>
+struct TStructOpsTypeTraits<FPEGameplayAbilityTargetData_MultiHit> : TStructOpsTypeTraitsBase2<FPEGameplayAbilityTargetData_MultiHit>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
@@ -0,0 +1,47 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <UObject/Interface.h>
+#include "PEPooledTargetActor.generated.h"
+
+class AGameplayAbilityTargetActor;
+class AGameplayAbilityWorldReticle;
+class UGameplayAbility;
+
+/**
+ *
+ */
+UINTERFACE(MinimalAPI, NotBlueprintable, Category = "Project Elementus | Interfaces")
+class UPEPooledTargetActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Targeting actors that can be parked in the UPEAbilitySystemComponent pool and reused by the next activation instead of being destroyed
+ */
+class PROJECTELEMENTUS_API IPEPooledTargetActor
+{
+	GENERATED_BODY()
+
+public:
+	/* Restore the actor state before being reconfigured by a new targeting task */
+	virtual void OnAcquiredFromPool() = 0;
+
+	/* Hide and stop the actor (and its reticle) while parked */
+	virtual void OnReleasedToPool() = 0;
+
+protected:
+	/* Call StartTargeting (the parent implementation) reusing the pooled reticle if it has the requested class, instead of spawning a new one */
+	static void StartTargetingWithPooledReticle(AGameplayAbilityTargetActor* TargetActor, TWeakObjectPtr<AGameplayAbilityWorldReticle>& ReticleActor, UGameplayAbility* Ability, TFunctionRef<void()> StartTargeting);
+
+	/* Default OnAcquiredFromPool implementation */
+	static void AcquireFromPool(AGameplayAbilityTargetActor* TargetActor);
+
+	/* Default OnReleasedToPool implementation */
+	static void ReleaseToPool(AGameplayAbilityTargetActor* TargetActor, const TWeakObjectPtr<AGameplayAbilityWorldReticle>& ReticleActor);
+};
@@ -8,12 +8,11 @@
 #include <Abilities/Tasks/AbilityTask.h>
 #include "PEMoveCamera_Task.generated.h"
 
-class UCameraComponent;
-class UTimelineComponent;
+class UPECameraOffsetComponent;
 	
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAimDelegate);
 /**
- * 
+ * Handle of a camera offset request blended by the avatar UPECameraOffsetComponent
  */
 UCLASS(NotBlueprintable, NotPlaceable, Category = "Project Elementus | Classes")
 class PROJECTELEMENTUS_API UPEMoveCamera_Task final : public UAbilityTask
@@ -23,9 +22,9 @@ class PROJECTELEMENTUS_API UPEMoveCamera_Task final : public UAbilityTask
 public:
 	explicit UPEMoveCamera_Task(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
-	/* Create a reference to manage this ability task */
+	/* Create a reference to manage this ability task. Requests with higher priorities are applied over the lower ones */
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions", meta = (HidePin = "OwningAbility", DefaultToSelf = "OwningAbility", BlueprintInternalUseOnly = "true"))
-	static UPEMoveCamera_Task* MoveCamera(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const FVector CameraRelativeTargetPosition, const float CameraLerpTime = 0.25f, const bool bAdjustTimeToCurrentLocation = true);
+	static UPEMoveCamera_Task* MoveCamera(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const FVector CameraRelativeTargetPosition, const float CameraLerpTime = 0.25f, const bool bAdjustTimeToCurrentLocation = true, const int32 Priority = 0);
 
 	UPROPERTY(BlueprintAssignable)
 	FAimDelegate OnMoveCompleted;
@@ -36,7 +35,7 @@ public:
 	UPROPERTY(BlueprintAssignable)
 	FAimDelegate OnFailed;
 
-	/* Revert the camera movement: Set camera location to initial position defined by APECharacter::GetCameraDefaultPosition() */
+	/* Revert the camera movement: Blend the camera back to the location resolved by the other requests */
 	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
 	void RevertCameraPosition();
 	
@@ -44,20 +43,14 @@ public:
 	virtual void OnDestroy(const bool AbilityIsEnding) override;
 
 private:
-	FVector CameraInitialPosition;
 	FVector CameraTargetPosition;
 	float CameraLerpTime;
 	bool bAdjustTimeToCurrentLocation;
+	int32 Priority;
 
-	float CurrentValue = 0.f;
-
-	TWeakObjectPtr<UCameraComponent> TargetCamera;
-	TWeakObjectPtr<UTimelineComponent> TaskTimeline;
+	int32 RequestHandle = INDEX_NONE;
+	TWeakObjectPtr<UPECameraOffsetComponent> CameraOffset;
 
 protected:
-	UFUNCTION()
-	virtual void TimelineProgress(const float InValue);
-	
-	UFUNCTION()
-	virtual void TimelineFinished();
+	void BlendFinished(const bool bReverted);
 };
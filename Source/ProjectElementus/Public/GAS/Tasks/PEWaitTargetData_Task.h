@@ -0,0 +1,35 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Abilities/Tasks/AbilityTask_WaitTargetData.h>
+#include "PEWaitTargetData_Task.generated.h"
+
+/**
+ * Wait target data using targeting actors from the owner UPEAbilitySystemComponent pool
+ * Pooled actors are parked when the task ends instead of being destroyed, so activations don't spawn a new actor each time
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Category = "Project Elementus | Classes")
+class PROJECTELEMENTUS_API UPEWaitTargetData_Task final : public UAbilityTask_WaitTargetData
+{
+	GENERATED_BODY()
+
+public:
+	/* Create a reference to manage this ability task */
+	static UPEWaitTargetData_Task* WaitPooledTargetData(UGameplayAbility* OwningAbility, const FName TaskInstanceName, const TEnumAsByte<EGameplayTargetingConfirmation::Type> ConfirmationType, const TSubclassOf<AGameplayAbilityTargetActor> InTargetClass);
+
+	/* Get a parked targeting actor from the pool or spawn a new one. Returns false if this machine doesn't need a targeting actor */
+	bool BeginSpawningPooledActor(UGameplayAbility* OwningAbility, const TSubclassOf<AGameplayAbilityTargetActor> InTargetClass, AGameplayAbilityTargetActor*& SpawnedActor);
+
+	/* Finish the spawn of a new actor or move a pooled actor to the owner, then start targeting */
+	void FinishSpawningPooledActor(UGameplayAbility* OwningAbility, AGameplayAbilityTargetActor* SpawnedActor);
+
+protected:
+	virtual void OnDestroy(bool AbilityEnded) override;
+
+private:
+	bool bIsPooledActor = false;
+};
@@ -0,0 +1,25 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Commandlets/Commandlet.h>
+#include "PECombatSimulatorCommandlet.generated.h"
+
+/**
+ * Headless simulation of the damage and leveling formulas over a matchup grid, with the results written to a CSV file
+ * Usage: -run=PECombatSimulator [-Output=Path.csv] [-MaxLevel=10] [-Samples=1000] [-BaseDamage=10] [-Seed=0]
+ *        [-MinRate=0.5] [-MaxRate=5] [-RateSteps=10] [-LevelingTable=/Game/Path/DT_Table] [-Equipment=/Game/Path/BP_A.BP_A_C,/Game/Path/BP_B.BP_B_C]
+ */
+UCLASS(NotBlueprintable, NotPlaceable, Category = "Project Elementus | Classes")
+class UPECombatSimulatorCommandlet final : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	explicit UPECombatSimulatorCommandlet(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual int32 Main(const FString& Params) override;
+};
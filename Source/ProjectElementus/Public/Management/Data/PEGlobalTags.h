@@ -4,55 +4,87 @@
 
 #pragma once
 
+#include <NativeGameplayTags.h>
+
 #pragma region Generic
-constexpr auto GlobalTag_GenericCooldown = "GameplayEffect.Cooldown";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_GenericCooldown);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_PlayerData);
 #pragma endregion Generic
 
 #pragma region SetByCaller
-constexpr auto GlobalTag_SetByCallerDuration = "SetByCaller.Duration";
-constexpr auto GlobalTag_SetByCallerHealth = "SetByCaller.Health";
-constexpr auto GlobalTag_SetByCallerStamina = "SetByCaller.Stamina";
-constexpr auto GlobalTag_SetByCallerMana = "SetByCaller.Mana";
-constexpr auto GlobalTag_SetByCallerFloat1 = "SetByCaller.Float1";
-constexpr auto GlobalTag_SetByCallerFloat2 = "SetByCaller.Float2";
-constexpr auto GlobalTag_SetByCallerFloat3 = "SetByCaller.Float3";
-constexpr auto GlobalTag_SetByCallerFloat4 = "SetByCaller.Float4";
-constexpr auto GlobalTag_SetByCallerFloat5 = "SetByCaller.Float5";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerDuration);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerHealth);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerStamina);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerMana);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerFloat1);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerFloat2);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerFloat3);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerFloat4);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_SetByCallerFloat5);
 #pragma endregion SetByCaller
 
 #pragma region Equipment
-constexpr auto GlobalTag_EquipSlot_Base = "EquipSlot";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_EquipSlot_Base);
 
-constexpr auto GlobalTag_WeaponSlot_Base = "EquipSlot.Weapon";
-constexpr auto GlobalTag_WeaponSlot_Both = "EquipSlot.Weapon.Both";
-constexpr auto GlobalTag_WeaponSlot_Left = "EquipSlot.Weapon.Left";
-constexpr auto GlobalTag_WeaponSlot_Right = "EquipSlot.Weapon.Right";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_WeaponSlot_Base);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_WeaponSlot_Both);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_WeaponSlot_Left);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_WeaponSlot_Right);
 #pragma endregion Equipment
 
 #pragma region Effect
-constexpr auto GlobalTag_Damage = "Data.Damage";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Damage);
 #pragma endregion Effect
 
 #pragma region State
-constexpr auto GlobalTag_CanInteract = "State.CanInteract";
-constexpr auto GlobalTag_CannotInteract = "State.CannotInteract";
-constexpr auto GlobalTag_DeadState = "State.Dead";
-constexpr auto GlobalTag_StunState = "State.Stunned";
-constexpr auto GlobalTag_AimingState = "State.Aiming";
-constexpr auto GlobalTag_AimingBlockedState = "State.Aiming.Blocked";
-constexpr auto GlobalTag_WaitingConfirmationState = "State.WaitingConfirm";
-constexpr auto GlobalTag_WaitingCancelationState = "State.WaitingCancel";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_CanInteract);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_CannotInteract);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_DeadState);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_StunState);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AimingState);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AimingBlockedState);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_WaitingConfirmationState);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_WaitingCancelationState);
 #pragma endregion State
 
 #pragma region Attributes
-constexpr auto GlobalTag_RegenBlock_Health = "GameplayEffect.Debuff.Regeneration.Block.Health";
-constexpr auto GlobalTag_RegenBlock_Mana = "GameplayEffect.Debuff.Regeneration.Block.Mana";
-constexpr auto GlobalTag_RegenBlock_Stamina = "GameplayEffect.Debuff.Regeneration.Block.Stamina";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_RegenBlock_Health);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_RegenBlock_Mana);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_RegenBlock_Stamina);
 
-constexpr auto GlobalTag_CostWhileActive_Stamina = "GameplayAbility.State.CostWhileActive.Stamina";
-constexpr auto GlobalTag_CostWhileActive_Mana = "GameplayAbility.State.CostWhileActive.Mana";
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_CostWhileActive_Stamina);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_CostWhileActive_Mana);
 #pragma endregion Attributes
 
 #pragma region AbilityNotify
-constexpr auto GlobalTag_AbilityNotify = "Data.Notify.Ability";
-#pragma endregion AbilityNotify
\ No newline at end of file
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AbilityNotify);
+#pragma endregion AbilityNotify
+
+#pragma region AbilityFailure
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AbilityFail_OnGive);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AbilityFail_TryActivate);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AbilityFail_PreActivate);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AbilityFail_CommitCheck);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AbilityFail_AuthorityOrPredictionKey);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_AbilityFail_Cooldown);
+#pragma endregion AbilityFailure
+
+#pragma region Abilities
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Crouch);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Dash);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_DoubleJump);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Interact);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Sprint);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Walk);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Swinging);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Telekinesis);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Regeneration_Health);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Regeneration_Mana);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Ability_Regeneration_Stamina);
+#pragma endregion Abilities
+
+#pragma region GameplayCues
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Cue_DoubleJump);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Cue_Swinging);
+PROJECTELEMENTUS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(GlobalTag_Cue_Telekinesis);
+#pragma endregion GameplayCues
@@ -18,4 +18,25 @@ class UPEAssetManager final : public UAssetManager
 
 public:
 	virtual void StartInitialLoading() override;
+
+	/* Get a class referenced by UPEProjectSettings from the preloaded cache */
+	template <typename T>
+	static TSubclassOf<T> GetProjectSettingsClass(const TSoftClassPtr<T>& InSoftClass)
+	{
+		return Cast<UClass>(GetProjectSettingsObject(InSoftClass.ToSoftObjectPath()));
+	}
+
+	/* Get a object referenced by UPEProjectSettings from the preloaded cache. Falls back to a synchronous load if the preload isn't finished */
+	PROJECTELEMENTUS_API static UObject* GetProjectSettingsObject(const FSoftObjectPath& InPath);
+
+private:
+	void PreloadProjectSettings();
+	void OnProjectSettingsLoaded();
+
+	static TArray<FSoftObjectPath> GetProjectSettingsReferences();
+
+	TSharedPtr<FStreamableHandle> ProjectSettingsHandle;
+
+	UPROPERTY(Transient)
+	TMap<FSoftObjectPath, TObjectPtr<UObject>> ResolvedProjectSettings;
 };
@@ -64,4 +64,24 @@ public:
 	/* Global stun effect used by GAS objects */
 	UPROPERTY(GlobalConfig, EditAnywhere, Category = "GAS | Effects")
 	TSoftClassPtr<UGameplayEffect> GlobalStunEffect;
+
+	/* Interval in seconds between each update of the regeneration subsystem */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "GAS | Regeneration", Meta = (ClampMin = "0.01"))
+	float RegenerationInterval;
+
+	/* Health regenerated per second by the regeneration subsystem. Above zero, replaces the periodic health regeneration ability */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "GAS | Regeneration", Meta = (ClampMin = "0"))
+	float HealthRegenerationRate;
+
+	/* Stamina regenerated per second by the regeneration subsystem. Above zero, replaces the periodic stamina regeneration ability */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "GAS | Regeneration", Meta = (ClampMin = "0"))
+	float StaminaRegenerationRate;
+
+	/* Mana regenerated per second by the regeneration subsystem. Above zero, replaces the periodic mana regeneration ability */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "GAS | Regeneration", Meta = (ClampMin = "0"))
+	float ManaRegenerationRate;
+
+	/* Replicate the attribute sets with quantized values, sending only the attributes changed for each connection. Requires restart */
+	UPROPERTY(GlobalConfig, EditAnywhere, Category = "GAS | Replication", Meta = (ConfigRestartRequired = true))
+	bool bQuantizedAttributeReplication;
 };
@@ -5,3 +5,6 @@
 #pragma once
 
 #include <CoreMinimal.h>
+#include <Stats/Stats.h>
+
+DECLARE_STATS_GROUP(TEXT("Project Elementus"), STATGROUP_ProjectElementus, STATCAT_Advanced);
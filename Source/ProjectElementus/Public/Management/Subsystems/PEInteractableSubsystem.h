@@ -0,0 +1,93 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Subsystems/WorldSubsystem.h>
+#include <UObject/ObjectKey.h>
+#include "PEInteractableSubsystem.generated.h"
+
+/**
+ * Uniform spatial hash of locations used by UPEInteractableSubsystem
+ * Element indices are stable until the element is removed
+ */
+class PROJECTELEMENTUS_API FPEInteractableSpatialHash
+{
+public:
+	explicit FPEInteractableSpatialHash(const float InCellSize);
+
+	int32 Add(const FVector& InLocation);
+	void Remove(const int32 InElement);
+
+	/* Move the element to the new location. Only changes the hash if the element left its cell */
+	void Update(const int32 InElement, const FVector& InLocation);
+
+	const FVector& GetLocation(const int32 InElement) const;
+	int32 Num() const;
+
+	/* Gather the elements inside the view cone, sorted from the closest to the view direction. InMinDot is the cosine of the cone half angle */
+	void QueryCone(const FVector& InOrigin, const FVector& InDirection, const float InRange, const float InMinDot, TArray<int32>& OutElements) const;
+
+private:
+	FIntVector GetCell(const FVector& InLocation) const;
+
+	struct FElement
+	{
+		FVector Location = FVector::ZeroVector;
+		FIntVector Cell = FIntVector::ZeroValue;
+		bool bInUse = false;
+	};
+
+	TArray<FElement> Elements;
+	TArray<int32> FreeElements;
+	TMap<FIntVector, TArray<int32>> Cells;
+
+	float CellSize;
+	int32 NumElements = 0;
+};
+
+/**
+ * Registry of the IPEInteractable actors in the world, stored in a uniform spatial hash
+ * Focus candidates are gathered with a view cone query over the nearby cells and a single trace confirms that the best candidate is not occluded
+ */
+UCLASS(MinimalAPI, NotBlueprintable, Category = "Project Elementus | Classes")
+class UPEInteractableSubsystem final : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UPEInteractableSubsystem();
+
+	PROJECTELEMENTUS_API static UPEInteractableSubsystem* Get(const UObject* WorldContext);
+
+	/* Register an actor implementing IPEInteractable. Native interactables register themselves on BeginPlay */
+	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
+	PROJECTELEMENTUS_API void Register(AActor* InActor);
+
+	UFUNCTION(BlueprintCallable, Category = "Project Elementus | Functions")
+	PROJECTELEMENTUS_API void Unregister(AActor* InActor);
+
+	/* Find the visible registered interactable closest to the view direction inside the cone. Occluded candidates are skipped, up to a few traces per query */
+	PROJECTELEMENTUS_API AActor* FindFocusCandidate(const FVector& InViewLocation, const FVector& InViewDirection, const float InRange, const float InConeHalfAngle, const FCollisionQueryParams& InParams, FHitResult& OutHitResult) const;
+
+	PROJECTELEMENTUS_API int32 GetNumRegistered() const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FPEInteractableSpatialHash SpatialHash;
+
+	/* Registered actors, indexed by their spatial hash element */
+	TArray<TWeakObjectPtr<AActor>> ElementActors;
+	TArray<FVector> ElementOffsets;
+	TMap<TObjectKey<AActor>, int32> RegisteredElements;
+
+	/* Elements with a movable root: Their locations are refreshed on each tick */
+	TArray<int32> MovableElements;
+};
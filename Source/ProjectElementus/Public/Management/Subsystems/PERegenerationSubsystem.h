@@ -0,0 +1,86 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <GameplayTagContainer.h>
+#include <Subsystems/WorldSubsystem.h>
+#include <UObject/ObjectKey.h>
+#include "PERegenerationSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+
+/* Attributes regenerated by UPERegenerationSubsystem */
+enum class EPERegenerationChannel : uint8
+{
+	Health,
+	Stamina,
+	Mana,
+
+	MAX
+};
+
+/**
+ * Server side regeneration of Health, Stamina and Mana
+ * Registered ability system components are kept in structure of arrays storage and updated in a single vectorized pass per interval,
+ * replacing a periodic effect execution per character and attribute
+ */
+UCLASS(MinimalAPI, NotBlueprintable, Category = "Project Elementus | Classes")
+class UPERegenerationSubsystem final : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	PROJECTELEMENTUS_API static UPERegenerationSubsystem* Get(const UObject* WorldContext);
+
+	/* Start regenerating the basic status of the ability system component using the rates from project settings. Only works with authority */
+	PROJECTELEMENTUS_API void Register(UAbilitySystemComponent* InABSC);
+
+	PROJECTELEMENTUS_API void Unregister(UAbilitySystemComponent* InABSC);
+
+	/* Change the rate (per second) used to regenerate the given channel of a registered ability system component */
+	PROJECTELEMENTUS_API void SetRegenerationRate(const UAbilitySystemComponent* InABSC, const EPERegenerationChannel InChannel, const float InRate);
+
+	PROJECTELEMENTUS_API int32 GetNumRegistered() const;
+
+	/* A channel is regenerated by the subsystem when its rate in project settings is above zero */
+	PROJECTELEMENTUS_API static bool IsChannelEnabled(const EPERegenerationChannel InChannel);
+
+	/* Check if the ability tags belong to a periodic regeneration ability (GameplayAbility.Default.Regeneration.*) of an enabled channel */
+	PROJECTELEMENTUS_API static bool IsReplacedRegenerationAbility(const FGameplayTagContainer& AbilityTags);
+
+	/* Regenerate the values in place: Value = Max(Value, Min(Value + Rate * Gate * DeltaTime, MaxValue)). Arrays must have the same size */
+	PROJECTELEMENTUS_API static void RegenerateBatch(TArrayView<float> Values, TArrayView<const float> MaxValues, TArrayView<const float> Rates, TArrayView<const float> Gates, const float DeltaTime);
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/* Structure of arrays storage of a regeneration channel. Gates are 0 while the channel is blocked and 1 otherwise */
+	struct FRegenerationChannelData
+	{
+		TArray<float> Values;
+		TArray<float> MaxValues;
+		TArray<float> Rates;
+		TArray<float> Gates;
+	};
+
+	void UpdateRegeneration(const float DeltaTime);
+	void RemoveEntry(const int32 Index);
+	void UpdateGates(const int32 Index);
+
+	void OnBlockTagChanged_Callback(const FGameplayTag BlockTag, const int32 NewCount, TObjectKey<UAbilitySystemComponent> ABSCKey);
+
+	TArray<TWeakObjectPtr<UAbilitySystemComponent>> RegisteredABSCs;
+	TArray<TObjectKey<UAbilitySystemComponent>> RegisteredKeys;
+	TMap<TObjectKey<UAbilitySystemComponent>, int32> RegisteredIndices;
+
+	FRegenerationChannelData Channels[static_cast<uint8>(EPERegenerationChannel::MAX)];
+
+	float ElapsedTime = 0.f;
+};
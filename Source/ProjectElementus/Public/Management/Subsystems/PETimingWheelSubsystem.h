@@ -0,0 +1,93 @@
+// Author: Lucas Vilas-Boas
+// Year: 2022
+// Repo: https://github.com/lucoiso/UEProject_Elementus
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Subsystems/WorldSubsystem.h>
+#include "PETimingWheelSubsystem.generated.h"
+
+/* Identifies an expiration scheduled in UPETimingWheelSubsystem */
+struct PROJECTELEMENTUS_API FPETimingWheelHandle
+{
+	FPETimingWheelHandle() = default;
+
+	bool IsValid() const
+	{
+		return Serial != 0;
+	}
+
+	void Invalidate()
+	{
+		Index = INDEX_NONE;
+		Serial = 0;
+	}
+
+	bool operator==(const FPETimingWheelHandle& Other) const
+	{
+		return Index == Other.Index && Serial == Other.Serial;
+	}
+
+private:
+	friend class UPETimingWheelSubsystem;
+
+	int32 Index = INDEX_NONE;
+	uint32 Serial = 0;
+};
+
+/**
+ * Hashed timing wheel used to schedule gameplay expirations (ability active time, death cleanup, respawn delays)
+ * All expirations due in a frame are processed in a single batched pass
+ */
+UCLASS(MinimalAPI, NotBlueprintable, Category = "Project Elementus | Classes")
+class UPETimingWheelSubsystem final : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	PROJECTELEMENTUS_API static UPETimingWheelSubsystem* Get(const UObject* WorldContext);
+
+	/* Schedule the delegate to be executed after InDelay seconds of game time. The delay is rounded up to the wheel resolution */
+	PROJECTELEMENTUS_API FPETimingWheelHandle Schedule(const float InDelay, FSimpleDelegate&& InDelegate);
+
+	/* Cancel a pending expiration and invalidate the handle */
+	PROJECTELEMENTUS_API void Cancel(FPETimingWheelHandle& InHandle);
+
+	/* Check if the handle still refers to a pending expiration */
+	PROJECTELEMENTUS_API bool IsPending(const FPETimingWheelHandle& InHandle) const;
+
+	PROJECTELEMENTUS_API int32 GetNumPending() const;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FWheelEntry
+	{
+		FSimpleDelegate Delegate;
+		int64 ExpirationTick = 0;
+		uint32 Serial = 0;
+	};
+
+	struct FWheelSlotEntry
+	{
+		int32 Index;
+		uint32 Serial;
+	};
+
+	void ReleaseEntry(const int32 Index);
+
+	TArray<FWheelEntry> Entries;
+	TArray<int32> FreeEntries;
+	TArray<TArray<FWheelSlotEntry>> Slots;
+	TArray<FSimpleDelegate> ExpiredDelegates;
+
+	double ElapsedTime = 0.0;
+	int64 CurrentTick = 0;
+	uint32 NextSerial = 1;
+	int32 NumPending = 0;
+};
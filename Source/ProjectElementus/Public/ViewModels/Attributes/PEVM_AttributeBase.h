@@ -7,17 +7,14 @@
 #include <CoreMinimal.h>
 #include <MVVMViewModelBase.h>
 #include <GameplayEffectTypes.h>
+#include <AttributeSet.h>
+#include <Containers/Ticker.h>
 #include "PEVM_AttributeBase.generated.h"
 
-#define CHECK_ATTRIBUTE_AND_SET_VALUE(AttributeClass, AttributeName) \
-if (AttributeChangeData.Attribute == ##AttributeClass##::Get##AttributeName##Attribute()) \
-{ \
-	Set##AttributeName##(AttributeChangeData.NewValue); \
-	return; \
-}
+class UAbilitySystemComponent;
 
 /**
- * 
+ * Base class of attribute view models: float properties are bound by name to the attributes with the same name of any attribute set
  */
 UCLASS(Abstract, BlueprintType, Category = "Project Elementus | Classes")
 class PROJECTELEMENTUS_API UPEVM_AttributeBase : public UMVVMViewModelBase
@@ -27,5 +24,40 @@ class PROJECTELEMENTUS_API UPEVM_AttributeBase : public UMVVMViewModelBase
 public:
 	explicit UPEVM_AttributeBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	/* Bind the attributes of the given set that matches this view model properties and set their initial values. Returns false if no attribute was bound */
+	bool BindAttributeSet(UAbilitySystemComponent* AbilitySystemComponent, const UAttributeSet* AttributeSet);
+
 	virtual void OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData);
+
+	/* Apply all the values staged in this frame */
+	void FlushDirtyFields();
+
+protected:
+	virtual void PostInitProperties() override;
+	virtual void BeginDestroy() override;
+
+	/* Called after a flush with the fields that had their values changed: Children must broadcast their derived fields here */
+	virtual void OnFieldsChanged(const uint32 ChangedFields);
+
+	/* Get the mask of the field bound to the given property. Returns 0 if the property isn't a bindable field */
+	uint32 GetFieldMask(const FName PropertyName) const;
+
+private:
+	struct FAttributeField
+	{
+		FFloatProperty* Property;
+		UE::FieldNotification::FFieldId FieldId;
+	};
+
+	/* Stage the new value of a field: Fields are flushed once per frame, so each field broadcasts at most once per frame */
+	void MarkFieldDirty(const uint8 FieldIndex, const float InValue);
+
+	void BuildFieldTable();
+
+	TArray<FAttributeField, TInlineAllocator<8>> Fields;
+	TMap<FGameplayAttribute, uint8> AttributeFieldIndices;
+
+	uint32 DirtyFields;
+	TArray<float, TInlineAllocator<8>> PendingValues;
+	FTSTicker::FDelegateHandle FlushTickerHandle;
 };
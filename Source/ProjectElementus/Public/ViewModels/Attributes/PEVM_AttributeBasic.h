@@ -46,7 +46,8 @@ public:
 	UPROPERTY(BlueprintReadWrite, FieldNotify, Setter, Getter, Category = "Project Elementus | Properties")
 	float MaxStamina;
 
-	virtual void OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData);
+protected:
+	virtual void OnFieldsChanged(const uint32 ChangedFields) override;
 
 private:
 	void SetHealth(const float InValue);
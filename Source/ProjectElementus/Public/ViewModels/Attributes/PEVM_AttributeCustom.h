@@ -34,8 +34,6 @@ public:
 	UPROPERTY(BlueprintReadWrite, FieldNotify, Setter, Getter, Category = "Project Elementus | Properties")
 	float Gold;
 
-	virtual void OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData);
-
 private:
 	void SetAttackRate(const float InValue);
 	float GetAttackRate() const;
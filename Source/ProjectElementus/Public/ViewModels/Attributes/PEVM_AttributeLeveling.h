@@ -31,7 +31,8 @@ public:
 	UFUNCTION(BlueprintPure, FieldNotify, Category = "Project Elementus | Functions")
 	float GetExperiencePercent() const;
 	
-	virtual void OnAttributeChange(const FOnAttributeChangeData& AttributeChangeData);
+protected:
+	virtual void OnFieldsChanged(const uint32 ChangedFields) override;
 
 private:
 	void SetCurrentLevel(const float InValue);